@@ -2,7 +2,30 @@
 #define __DoubleLinkList_QUEUE_H_
 
 #include "common.h"
+
+/* 队列的底层实现: 1 使用循环数组, 0 使用双向链表. 也可以编译时用 -DDOUBLE_LINK_LIST_QUEUE_USE_ARRAY=0 指定 */
+#ifndef DOUBLE_LINK_LIST_QUEUE_USE_ARRAY
+#define DOUBLE_LINK_LIST_QUEUE_USE_ARRAY    1
+#endif
+
+#if DOUBLE_LINK_LIST_QUEUE_USE_ARRAY
+/* 循环数组的初始容量 (2的幂) */
+#define DOUBLE_LINK_LIST_QUEUE_INIT_CAPACITY    16
+
+/* 循环数组队列: 容量是2的幂, 下标用掩码回绕, 满了翻倍扩容. 入队出队不再申请释放结点 */
+typedef struct DoubleLinkListQueue
+{
+    ELEMENTTYPE *data;
+    /* 容量 (2的幂) */
+    int capacity;
+    /* 队头的下标 */
+    int front;
+    /* 队列的大小 */
+    int len;
+} DoubleLinkListQueue;
+#else
 typedef DoubleLinkList DoubleLinkListQueue;
+#endif
 
 /* 队列初始化 */
 int doubleLinkListQueueInit(DoubleLinkListQueue **pQueue);
@@ -25,7 +48,16 @@ int doubleLinkListQueueGetSize(DoubleLinkListQueue *pQueue, int *pSize);
 /* 队列是否为空 */
 int doubleLinkListQueueIsEmpty(DoubleLinkListQueue *pQueue);
 
+/* 批量入队: vals 中的 num 个元素依次入队 */
+int doubleLinkListQueuePushBatch(DoubleLinkListQueue *pQueue, ELEMENTTYPE *vals, int num);
+
+/* 批量出队: 最多取出 max 个元素放到 buf 里, 实际个数放到 *pPopNum */
+int doubleLinkListQueuePopBatch(DoubleLinkListQueue *pQueue, ELEMENTTYPE *buf, int max, int *pPopNum);
+
+/* 整体取走: 把队列里的所有元素按顺序接到 pDst 队尾, 之后 pQueue 为空 (pDst 为空时 O(1)) */
+int doubleLinkListQueueDrain(DoubleLinkListQueue *pQueue, DoubleLinkListQueue *pDst);
+
 /* 队列销毁*/
 int doubleLinkListQueueDestroy(DoubleLinkListQueue *pQueue);
 
-#endif // __DoubleLinkList_QUEUE_H_
\ No newline at end of file
+#endif // __DoubleLinkList_QUEUE_H_
@@ -46,4 +46,26 @@ int DoubleLinkListGetTailVal(DoubleLinkList * pList, ELEMENTTYPE *pVal);
 
 /* 获取链表 指定位置的值 */
 int DoubleLinkListGetAppointPosVal(DoubleLinkList * pList, int pos, ELEMENTTYPE *pVal);
+
+/* 设置跳跃索引: 每 step 个结点记录一次, 按位置访问降到 O(n/step). step <= 0 时关闭 */
+int DoubleLinkListSetSkipIndex(DoubleLinkList * pList, int step);
+
+/* 链表拼接: 把 pSrc 的所有结点接到 pDst 尾部 O(1), 拼接后 pSrc 为空 */
+int DoubleLinkListConcat(DoubleLinkList * pDst, DoubleLinkList * pSrc);
+
+/* 链表拆分: 把 pos 位置开始到末尾的结点接到 pDst 尾部, 不申请新结点. 定位 pos 需要 O(min(pos, len - pos)) (跳跃索引有效时 O(step)) */
+int DoubleLinkListSplitAt(DoubleLinkList * pList, int pos, DoubleLinkList * pDst);
+
+/* 结点搬移: 把 pSrc 从 srcPos 开始的 num 个结点移动到 pDst 的 dstPos 位置, 不申请新结点. 定位三个位置的代价同上, 搬移本身 O(1) */
+int DoubleLinkListSplice(DoubleLinkList * pDst, int dstPos, DoubleLinkList * pSrc, int srcPos, int num);
+
+/* 链表拆分 (按结点): 把 node 开始到末尾的 num 个结点接到 pDst 尾部 O(1), num 由调用者给出 (必须等于 node 到末尾的结点个数, 调试版本会核对) */
+int DoubleLinkListSplitAtNode(DoubleLinkList * pList, DoubleLinkNode *node, int num, DoubleLinkList * pDst);
+
+/*
+ * 结点搬移 (按结点): 把 pSrc 中 [first, last] 这 num 个结点移动到 pDst 的 prevNode 后面 O(1).
+ * prevNode 为 pDst->head 时插到头部. pDst 和 pSrc 可以是同一个链表, 此时 prevNode 不能在 [first, last] 中.
+ * num 必须等于 [first, last] 的结点个数 (调试版本会核对, 不符时返回 INVALID_ACCESS)
+ */
+int DoubleLinkListSpliceNodes(DoubleLinkList * pDst, DoubleLinkNode *prevNode, DoubleLinkList * pSrc, DoubleLinkNode *first, DoubleLinkNode *last, int num);
 #endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef __COMMON_H_
+#define __COMMON_H_
+
+#define ELEMENTTYPE void*
+
+/* 链表结点取别名 */
+typedef struct DoubleLinkNode
+{
+    ELEMENTTYPE data;
+
+    /* 指向前一个结点的指针 */
+    struct DoubleLinkNode * prev;
+    /* 指向下一个结点的指针 */
+    struct DoubleLinkNode *next;   /* 指针的类型为什么是结点 */
+} DoubleLinkNode;
+
+
+/* 链表 */
+typedef struct DoubleLinkList
+{
+    /* 链表的虚拟头结点 */
+    DoubleLinkNode * head;
+    DoubleLinkNode * tail;        /* 为什么尾指针不需要分配空间??? */
+    /* 链表的长度 */
+    int len;
+    /* 跳跃索引: skipIndex[i] 是第 i * skipStep 个结点 (skipStep 为0表示不使用) */
+    DoubleLinkNode ** skipIndex;
+    int skipStep;
+    /* 前 skipValidNum 项是有效的 (位置变动之后后面的项失效, 用到时再补建) */
+    int skipValidNum;
+    int skipCapacity;
+} DoubleLinkList;
+
+
+#endif
\ No newline at end of file
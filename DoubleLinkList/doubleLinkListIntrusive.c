@@ -0,0 +1,279 @@
+#include "doubleLinkListIntrusive.h"
+#include <stdlib.h>
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    NOT_FIND = -1,
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 静态前置声明 */
+static void DoubleLinkHookLink(DoubleLinkIntrusiveList *pList, DoubleLinkHook *prevHook, DoubleLinkHook *nextHook, DoubleLinkHook *pHook);
+static void DoubleLinkHookUnlink(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 把挂钩插到 prevHook 和 nextHook 之间 */
+static void DoubleLinkHookLink(DoubleLinkIntrusiveList *pList, DoubleLinkHook *prevHook, DoubleLinkHook *nextHook, DoubleLinkHook *pHook)
+{
+    pHook->prev = prevHook;
+    pHook->next = nextHook;
+    prevHook->next = pHook;
+    nextHook->prev = pHook;
+    (pList->len)++;
+}
+
+/* 摘下挂钩 */
+static void DoubleLinkHookUnlink(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    pHook->prev->next = pHook->next;
+    pHook->next->prev = pHook->prev;
+    pHook->prev = NULL;
+    pHook->next = NULL;
+    (pList->len)--;
+}
+
+/* 链表初始化 (链表可以直接定义在栈上或嵌入到别的结构体里, 不申请内存) */
+int DoubleLinkIntrusiveListInit(DoubleLinkIntrusiveList *pList)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 空链表: 哨兵自己指向自己 */
+    pList->head.prev = &pList->head;
+    pList->head.next = &pList->head;
+    pList->len = 0;
+    return ON_SUCCESS;
+}
+
+/* 挂钩初始化: 未挂到链表上的挂钩 prev/next 为NULL */
+int DoubleLinkHookInit(DoubleLinkHook *pHook)
+{
+    if (pHook == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    pHook->prev = NULL;
+    pHook->next = NULL;
+    return ON_SUCCESS;
+}
+
+/* 挂钩是否已经挂在某个链表上 */
+int DoubleLinkHookIsLinked(DoubleLinkHook *pHook)
+{
+    return (pHook != NULL && pHook->next != NULL) ? 1 : 0;
+}
+
+/* 链表头插 O(1) */
+int DoubleLinkIntrusiveListPushFront(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    return DoubleLinkIntrusiveListInsertAfter(pList, &pList->head, pHook);
+}
+
+/* 链表尾插 O(1) */
+int DoubleLinkIntrusiveListPushBack(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    return DoubleLinkIntrusiveListInsertBefore(pList, &pList->head, pHook);
+}
+
+/* 在 pPos 之后插入 O(1) */
+int DoubleLinkIntrusiveListInsertAfter(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pPos, DoubleLinkHook *pHook)
+{
+    if (pList == NULL || pPos == NULL || pHook == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 一个挂钩同一时刻只能在一个链表里 */
+    if (DoubleLinkHookIsLinked(pHook) || pPos->next == NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    DoubleLinkHookLink(pList, pPos, pPos->next, pHook);
+    return ON_SUCCESS;
+}
+
+/* 在 pPos 之前插入 O(1) */
+int DoubleLinkIntrusiveListInsertBefore(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pPos, DoubleLinkHook *pHook)
+{
+    if (pList == NULL || pPos == NULL || pHook == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (DoubleLinkHookIsLinked(pHook) || pPos->prev == NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    DoubleLinkHookLink(pList, pPos->prev, pPos, pHook);
+    return ON_SUCCESS;
+}
+
+/* 从链表中摘下挂钩 O(1), 不释放内存 */
+int DoubleLinkIntrusiveListRemove(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    if (pList == NULL || pHook == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 没挂在链表上, 或者是哨兵自己 */
+    if (!DoubleLinkHookIsLinked(pHook) || pHook == &pList->head)
+    {
+        return INVALID_ACCESS;
+    }
+
+    DoubleLinkHookUnlink(pList, pHook);
+    return ON_SUCCESS;
+}
+
+/* 把已经在链表中的挂钩移动到链表头部 O(1) (LRU 命中时使用) */
+int DoubleLinkIntrusiveListMoveToFront(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    int ret = DoubleLinkIntrusiveListRemove(pList, pHook);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+    return DoubleLinkIntrusiveListPushFront(pList, pHook);
+}
+
+/* 链表头删 O(1): 取出第一个挂钩 */
+int DoubleLinkIntrusiveListPopFront(DoubleLinkIntrusiveList *pList, DoubleLinkHook **pHook)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    DoubleLinkHook *hook = pList->head.next;
+    DoubleLinkHookUnlink(pList, hook);
+    if (pHook != NULL)
+    {
+        *pHook = hook;
+    }
+    return ON_SUCCESS;
+}
+
+/* 链表尾删 O(1): 取出最后一个挂钩 */
+int DoubleLinkIntrusiveListPopBack(DoubleLinkIntrusiveList *pList, DoubleLinkHook **pHook)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    DoubleLinkHook *hook = pList->head.prev;
+    DoubleLinkHookUnlink(pList, hook);
+    if (pHook != NULL)
+    {
+        *pHook = hook;
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取第一个挂钩 (空链表为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListFront(DoubleLinkIntrusiveList *pList)
+{
+    if (pList == NULL || pList->len == 0)
+    {
+        return NULL;
+    }
+    return pList->head.next;
+}
+
+/* 获取最后一个挂钩 (空链表为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListBack(DoubleLinkIntrusiveList *pList)
+{
+    if (pList == NULL || pList->len == 0)
+    {
+        return NULL;
+    }
+    return pList->head.prev;
+}
+
+/* 获取下一个挂钩 (已经是最后一个时为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListNext(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    if (pList == NULL || pHook == NULL || pHook->next == &pList->head)
+    {
+        return NULL;
+    }
+    return pHook->next;
+}
+
+/* 获取前一个挂钩 (已经是第一个时为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListPrev(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook)
+{
+    if (pList == NULL || pHook == NULL || pHook->prev == &pList->head)
+    {
+        return NULL;
+    }
+    return pHook->prev;
+}
+
+/* 获取链表的长度 */
+int DoubleLinkIntrusiveListGetLength(DoubleLinkIntrusiveList *pList, int *pSize)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pSize != NULL)
+    {
+        *pSize = pList->len;
+    }
+    return pList->len;
+}
+
+/* 清空链表: 只摘下所有挂钩, 元素的内存由使用者管理 */
+int DoubleLinkIntrusiveListClear(DoubleLinkIntrusiveList *pList)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    DoubleLinkHook *travelHook = pList->head.next;
+    while (travelHook != &pList->head)
+    {
+        DoubleLinkHook *nextHook = travelHook->next;
+        travelHook->prev = NULL;
+        travelHook->next = NULL;
+        travelHook = nextHook;
+    }
+    return DoubleLinkIntrusiveListInit(pList);
+}
+
+/* 链表遍历接口 (回调里不能删除当前挂钩) */
+int DoubleLinkIntrusiveListForeach(DoubleLinkIntrusiveList *pList, int (*visitFunc)(DoubleLinkHook *))
+{
+    if (pList == NULL || visitFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    for (DoubleLinkHook *travelHook = pList->head.next; travelHook != &pList->head; travelHook = travelHook->next)
+    {
+        visitFunc(travelHook);
+    }
+    return ON_SUCCESS;
+}
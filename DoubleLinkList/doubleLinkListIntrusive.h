@@ -0,0 +1,82 @@
+#ifndef __DOUBLE_LINK_LIST_INTRUSIVE_H_
+#define __DOUBLE_LINK_LIST_INTRUSIVE_H_
+
+#include <stddef.h>
+
+/* 侵入式链表的挂钩: 嵌入到用户结构体里, 链表只串挂钩, 不再为每个元素申请结点 */
+typedef struct DoubleLinkHook
+{
+    /* 指向前一个挂钩的指针 */
+    struct DoubleLinkHook *prev;
+    /* 指向下一个挂钩的指针 */
+    struct DoubleLinkHook *next;
+} DoubleLinkHook;
+
+/* 侵入式双向链表: 头结点是环形的哨兵, 头尾插入删除不需要判断边界 */
+typedef struct DoubleLinkIntrusiveList
+{
+    /* 哨兵: head.next 是第一个元素, head.prev 是最后一个元素 */
+    DoubleLinkHook head;
+    /* 链表的长度 */
+    int len;
+} DoubleLinkIntrusiveList;
+
+/* 根据挂钩的地址得到外层结构体的地址 */
+#define DOUBLE_LINK_CONTAINER_OF(hookPtr, type, member) \
+    ((type *)((char *)(hookPtr) - offsetof(type, member)))
+
+/* 链表初始化 (链表可以直接定义在栈上或嵌入到别的结构体里, 不申请内存) */
+int DoubleLinkIntrusiveListInit(DoubleLinkIntrusiveList *pList);
+
+/* 挂钩初始化: 未挂到链表上的挂钩 prev/next 为NULL */
+int DoubleLinkHookInit(DoubleLinkHook *pHook);
+
+/* 挂钩是否已经挂在某个链表上 */
+int DoubleLinkHookIsLinked(DoubleLinkHook *pHook);
+
+/* 链表头插 O(1) */
+int DoubleLinkIntrusiveListPushFront(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 链表尾插 O(1) */
+int DoubleLinkIntrusiveListPushBack(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 在 pPos 之后插入 O(1) */
+int DoubleLinkIntrusiveListInsertAfter(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pPos, DoubleLinkHook *pHook);
+
+/* 在 pPos 之前插入 O(1) */
+int DoubleLinkIntrusiveListInsertBefore(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pPos, DoubleLinkHook *pHook);
+
+/* 从链表中摘下挂钩 O(1), 不释放内存 */
+int DoubleLinkIntrusiveListRemove(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 把已经在链表中的挂钩移动到链表头部 O(1) (LRU 命中时使用) */
+int DoubleLinkIntrusiveListMoveToFront(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 链表头删 O(1): 取出第一个挂钩 */
+int DoubleLinkIntrusiveListPopFront(DoubleLinkIntrusiveList *pList, DoubleLinkHook **pHook);
+
+/* 链表尾删 O(1): 取出最后一个挂钩 */
+int DoubleLinkIntrusiveListPopBack(DoubleLinkIntrusiveList *pList, DoubleLinkHook **pHook);
+
+/* 获取第一个挂钩 (空链表为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListFront(DoubleLinkIntrusiveList *pList);
+
+/* 获取最后一个挂钩 (空链表为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListBack(DoubleLinkIntrusiveList *pList);
+
+/* 获取下一个挂钩 (已经是最后一个时为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListNext(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 获取前一个挂钩 (已经是第一个时为NULL) */
+DoubleLinkHook * DoubleLinkIntrusiveListPrev(DoubleLinkIntrusiveList *pList, DoubleLinkHook *pHook);
+
+/* 获取链表的长度 */
+int DoubleLinkIntrusiveListGetLength(DoubleLinkIntrusiveList *pList, int *pSize);
+
+/* 清空链表: 只摘下所有挂钩, 元素的内存由使用者管理 */
+int DoubleLinkIntrusiveListClear(DoubleLinkIntrusiveList *pList);
+
+/* 链表遍历接口 (回调里不能删除当前挂钩) */
+int DoubleLinkIntrusiveListForeach(DoubleLinkIntrusiveList *pList, int (*visitFunc)(DoubleLinkHook *));
+
+#endif // __DOUBLE_LINK_LIST_INTRUSIVE_H_
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include "doubleLinkList.h"
+#include "doubleLinkListIntrusive.h"
 #include <string.h>
 
 #define BUFFER_SIZE    3
@@ -33,6 +34,20 @@ int compareData(void *arg1, void *arg2)
     return data1 - data2;
 }
 
+/* 侵入式链表: 挂钩嵌入到结构体里 */
+typedef struct stuNode
+{
+    int age;
+    DoubleLinkHook hook;
+} stuNode;
+
+int printStuNode(DoubleLinkHook *hook)
+{
+    stuNode *node = DOUBLE_LINK_CONTAINER_OF(hook, stuNode, hook);
+    printf("age:%d\t", node->age);
+    return 0;
+}
+
 int main()
 {
     DoubleLinkList *list = NULL;
@@ -120,6 +135,31 @@ int main()
     
     /* 释放链表 */
     DoubleLinkListDestroy(list);
+#elif 0
+    /* 侵入式链表: 插入删除都不申请内存 */
+    stuNode nodes[BUFFER_SIZE];
+    DoubleLinkIntrusiveList intrusiveList;
+    DoubleLinkIntrusiveListInit(&intrusiveList);
+    for (int idx = 0; idx < BUFFER_SIZE; idx++)
+    {
+        nodes[idx].age = (idx + 1) * 10;
+        DoubleLinkHookInit(&nodes[idx].hook);
+        DoubleLinkIntrusiveListPushBack(&intrusiveList, &nodes[idx].hook);
+    }
+    DoubleLinkIntrusiveListForeach(&intrusiveList, printStuNode);
+    printf("\n");
+
+    /* 最后一个元素移到头部 */
+    DoubleLinkIntrusiveListMoveToFront(&intrusiveList, &nodes[BUFFER_SIZE - 1].hook);
+    DoubleLinkIntrusiveListForeach(&intrusiveList, printStuNode);
+    printf("\n");
+
+    DoubleLinkIntrusiveListRemove(&intrusiveList, &nodes[0].hook);
+    DoubleLinkIntrusiveListForeach(&intrusiveList, printStuNode);
+    printf("\n");
+
+    DoubleLinkIntrusiveListClear(&intrusiveList);
+    DoubleLinkListDestroy(list);
 #elif 0
     stuInfo stu1, stu2, stu3;
     memset(&stu1, 0, sizeof(stu1));
@@ -23,6 +23,12 @@ typedef struct DoubleLinkList
     DoubleLinkNode * tail;        /* 为什么尾指针不需要分配空间??? */
     /* 链表的长度 */
     int len;
+    /* 跳跃索引: skipIndex[i] 是第 i * skipStep 个结点 (skipStep 为0表示不使用) */
+    DoubleLinkNode ** skipIndex;
+    int skipStep;
+    /* 前 skipValidNum 项是有效的 (位置变动之后后面的项失效, 用到时再补建) */
+    int skipValidNum;
+    int skipCapacity;
 } DoubleLinkList;
 
 
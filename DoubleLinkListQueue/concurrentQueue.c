@@ -0,0 +1,387 @@
+#include "concurrentQueue.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 阻塞版本先自旋这么多次, 再让出cpu */
+#define CONCURRENT_QUEUE_SPIN_TIMES     128
+
+/* 静态函数前置声明 */
+static unsigned long roundUpPowerOfTwo(int capacity);
+static void concurrentQueueBackoff(int *pSpin);
+
+/* 容量向上取整到2的幂 */
+static unsigned long roundUpPowerOfTwo(int capacity)
+{
+    unsigned long size = 2;
+    while (size < (unsigned long)capacity)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+/* 等待: 先自旋, 等太久就让出cpu */
+static void concurrentQueueBackoff(int *pSpin)
+{
+    if (*pSpin < CONCURRENT_QUEUE_SPIN_TIMES)
+    {
+        (*pSpin)++;
+        return;
+    }
+    sched_yield();
+}
+
+/* 队列初始化 (容量向上取整到2的幂) */
+int spscQueueInit(spscQueue **pQueue, int capacity)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (capacity <= 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    /* 成员按缓存行对齐, 需要对齐的内存 */
+    spscQueue *queue = (spscQueue *)aligned_alloc(CONCURRENT_QUEUE_CACHE_LINE, sizeof(spscQueue));
+    if (queue == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(queue, 0, sizeof(spscQueue));
+
+    unsigned long size = roundUpPowerOfTwo(capacity);
+    queue->data = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * size);
+    if (queue->data == NULL)
+    {
+        free(queue);
+        return MALLOC_ERROR;
+    }
+    queue->mask = size - 1;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+
+    *pQueue = queue;
+    return ON_SUCCESS;
+}
+
+/* 尝试入队 (只能由生产者线程调用, 队列满返回 INVALID_ACCESS) */
+int spscQueueTryPush(spscQueue *pQueue, ELEMENTTYPE val)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* tail 只有自己写, 不需要同步 */
+    unsigned long tail = atomic_load_explicit(&pQueue->tail, memory_order_relaxed);
+    if (tail - pQueue->cachedHead > pQueue->mask)
+    {
+        /* 按缓存的值已经满了, 重新读一次消费者的位置 */
+        pQueue->cachedHead = atomic_load_explicit(&pQueue->head, memory_order_acquire);
+        if (tail - pQueue->cachedHead > pQueue->mask)
+        {
+            return INVALID_ACCESS;
+        }
+    }
+
+    pQueue->data[tail & pQueue->mask] = val;
+    /* 发布: 消费者看到新的 tail 时一定能看到写入的数据 */
+    atomic_store_explicit(&pQueue->tail, tail + 1, memory_order_release);
+    return ON_SUCCESS;
+}
+
+/* 入队 (只能由生产者线程调用, 队列满时等待) */
+int spscQueuePush(spscQueue *pQueue, ELEMENTTYPE val)
+{
+    int spin = 0;
+    int ret = 0;
+    while ((ret = spscQueueTryPush(pQueue, val)) == INVALID_ACCESS)
+    {
+        concurrentQueueBackoff(&spin);
+    }
+    return ret;
+}
+
+/* 尝试出队 (只能由消费者线程调用, 队列空返回 INVALID_ACCESS) */
+int spscQueueTryPop(spscQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* head 只有自己写, 不需要同步 */
+    unsigned long head = atomic_load_explicit(&pQueue->head, memory_order_relaxed);
+    if (head == pQueue->cachedTail)
+    {
+        /* 按缓存的值已经空了, 重新读一次生产者的位置 */
+        pQueue->cachedTail = atomic_load_explicit(&pQueue->tail, memory_order_acquire);
+        if (head == pQueue->cachedTail)
+        {
+            return INVALID_ACCESS;
+        }
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pQueue->data[head & pQueue->mask];
+    }
+    /* 归还槽位: 生产者看到新的 head 时数据已经读完 */
+    atomic_store_explicit(&pQueue->head, head + 1, memory_order_release);
+    return ON_SUCCESS;
+}
+
+/* 出队 (只能由消费者线程调用, 队列空时等待) */
+int spscQueuePop(spscQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    int spin = 0;
+    int ret = 0;
+    while ((ret = spscQueueTryPop(pQueue, pVal)) == INVALID_ACCESS)
+    {
+        concurrentQueueBackoff(&spin);
+    }
+    return ret;
+}
+
+/* 队列大小 (只是某一时刻的快照) */
+int spscQueueGetSize(spscQueue *pQueue, int *pSize)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unsigned long head = atomic_load(&pQueue->head);
+    unsigned long tail = atomic_load(&pQueue->tail);
+    int size = (int)(tail - head);
+    if (pSize != NULL)
+    {
+        *pSize = size;
+    }
+    return size;
+}
+
+/* 队列销毁 (调用时不能有其他线程在使用) */
+int spscQueueDestroy(spscQueue *pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->data != NULL)
+    {
+        free(pQueue->data);
+        pQueue->data = NULL;
+    }
+    free(pQueue);
+    return ON_SUCCESS;
+}
+
+/* 队列初始化 (容量向上取整到2的幂, 至少为2) */
+int mpmcQueueInit(mpmcQueue **pQueue, int capacity)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (capacity <= 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    /* 成员按缓存行对齐, 需要对齐的内存 */
+    mpmcQueue *queue = (mpmcQueue *)aligned_alloc(CONCURRENT_QUEUE_CACHE_LINE, sizeof(mpmcQueue));
+    if (queue == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(queue, 0, sizeof(mpmcQueue));
+
+    unsigned long size = roundUpPowerOfTwo(capacity);
+    queue->cells = (mpmcQueueCell *)malloc(sizeof(mpmcQueueCell) * size);
+    if (queue->cells == NULL)
+    {
+        free(queue);
+        return MALLOC_ERROR;
+    }
+    /* 第 idx 个槽位等待位置 idx 的生产者 */
+    for (unsigned long idx = 0; idx < size; idx++)
+    {
+        atomic_init(&queue->cells[idx].sequence, idx);
+        queue->cells[idx].data = NULL;
+    }
+    queue->mask = size - 1;
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+
+    *pQueue = queue;
+    return ON_SUCCESS;
+}
+
+/* 尝试入队 (线程安全, 队列满返回 INVALID_ACCESS) */
+int mpmcQueueTryPush(mpmcQueue *pQueue, ELEMENTTYPE val)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    mpmcQueueCell *cell = NULL;
+    unsigned long pos = atomic_load_explicit(&pQueue->enqueuePos, memory_order_relaxed);
+    while (1)
+    {
+        cell = &pQueue->cells[pos & pQueue->mask];
+        unsigned long seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        long diff = (long)seq - (long)pos;
+        if (diff == 0)
+        {
+            /* 槽位空闲: 抢这个位置, 失败时 pos 会被更新成最新的值 */
+            if (atomic_compare_exchange_weak_explicit(&pQueue->enqueuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* 槽位还没被上一轮的消费者取走: 队列满 */
+            return INVALID_ACCESS;
+        }
+        else
+        {
+            /* 位置已被别的生产者抢走 */
+            pos = atomic_load_explicit(&pQueue->enqueuePos, memory_order_relaxed);
+        }
+    }
+
+    cell->data = val;
+    /* 发布: 序号变成 pos + 1 后消费者才能读 */
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    return ON_SUCCESS;
+}
+
+/* 入队 (线程安全, 队列满时等待) */
+int mpmcQueuePush(mpmcQueue *pQueue, ELEMENTTYPE val)
+{
+    int spin = 0;
+    int ret = 0;
+    while ((ret = mpmcQueueTryPush(pQueue, val)) == INVALID_ACCESS)
+    {
+        concurrentQueueBackoff(&spin);
+    }
+    return ret;
+}
+
+/* 尝试出队 (线程安全, 队列空返回 INVALID_ACCESS) */
+int mpmcQueueTryPop(mpmcQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    mpmcQueueCell *cell = NULL;
+    unsigned long pos = atomic_load_explicit(&pQueue->dequeuePos, memory_order_relaxed);
+    while (1)
+    {
+        cell = &pQueue->cells[pos & pQueue->mask];
+        unsigned long seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        long diff = (long)seq - (long)(pos + 1);
+        if (diff == 0)
+        {
+            /* 槽位有数据: 抢这个位置 */
+            if (atomic_compare_exchange_weak_explicit(&pQueue->dequeuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* 生产者还没写入: 队列空 */
+            return INVALID_ACCESS;
+        }
+        else
+        {
+            /* 位置已被别的消费者抢走 */
+            pos = atomic_load_explicit(&pQueue->dequeuePos, memory_order_relaxed);
+        }
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = cell->data;
+    }
+    /* 归还槽位: 留给下一轮 (pos + 容量) 的生产者 */
+    atomic_store_explicit(&cell->sequence, pos + pQueue->mask + 1, memory_order_release);
+    return ON_SUCCESS;
+}
+
+/* 出队 (线程安全, 队列空时等待) */
+int mpmcQueuePop(mpmcQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    int spin = 0;
+    int ret = 0;
+    while ((ret = mpmcQueueTryPop(pQueue, pVal)) == INVALID_ACCESS)
+    {
+        concurrentQueueBackoff(&spin);
+    }
+    return ret;
+}
+
+/* 队列大小 (只是某一时刻的快照) */
+int mpmcQueueGetSize(mpmcQueue *pQueue, int *pSize)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unsigned long dequeuePos = atomic_load(&pQueue->dequeuePos);
+    unsigned long enqueuePos = atomic_load(&pQueue->enqueuePos);
+    /* 并发时两个位置不是同一时刻读到的, 可能出现负数 */
+    long size = (long)(enqueuePos - dequeuePos);
+    if (size < 0)
+    {
+        size = 0;
+    }
+    if (pSize != NULL)
+    {
+        *pSize = (int)size;
+    }
+    return (int)size;
+}
+
+/* 队列销毁 (调用时不能有其他线程在使用) */
+int mpmcQueueDestroy(mpmcQueue *pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->cells != NULL)
+    {
+        free(pQueue->cells);
+        pQueue->cells = NULL;
+    }
+    free(pQueue);
+    return ON_SUCCESS;
+}
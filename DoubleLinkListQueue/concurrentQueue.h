@@ -0,0 +1,96 @@
+#ifndef __CONCURRENT_QUEUE_H_
+#define __CONCURRENT_QUEUE_H_
+
+#include "common.h"
+#include <stdatomic.h>
+
+/* 缓存行大小 */
+#define CONCURRENT_QUEUE_CACHE_LINE     64
+
+/*
+ * 单生产者单消费者环形队列 (wait-free).
+ * 生产者只写 tail, 消费者只写 head, 两者放在不同的缓存行上, 互不干扰.
+ * 双方各自缓存一份对方的下标, 只有缓存的值显示满/空时才去读对方的缓存行.
+ */
+typedef struct spscQueue
+{
+    /* 生产者使用 */
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) _Atomic unsigned long tail;
+    unsigned long cachedHead;
+    /* 消费者使用 */
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) _Atomic unsigned long head;
+    unsigned long cachedTail;
+    /* 只读成员 */
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) ELEMENTTYPE *data;
+    /* 容量 - 1 (容量是2的幂) */
+    unsigned long mask;
+} spscQueue;
+
+/* 多生产者多消费者有界队列的槽位 */
+typedef struct mpmcQueueCell
+{
+    /* 序号: 等于入队位置时可以写, 等于入队位置+1时可以读 */
+    _Atomic unsigned long sequence;
+    ELEMENTTYPE data;
+} mpmcQueueCell;
+
+/*
+ * 多生产者多消费者有界队列 (Vyukov).
+ * 每个槽位带一个序号, 生产者/消费者先用 CAS 抢到位置, 再通过序号判断槽位是否可用,
+ * 不同位置的读写互不影响.
+ */
+typedef struct mpmcQueue
+{
+    /* 下一个入队位置 */
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) _Atomic unsigned long enqueuePos;
+    /* 下一个出队位置 */
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) _Atomic unsigned long dequeuePos;
+    /* 只读成员 */
+    _Alignas(CONCURRENT_QUEUE_CACHE_LINE) mpmcQueueCell *cells;
+    /* 容量 - 1 (容量是2的幂) */
+    unsigned long mask;
+} mpmcQueue;
+
+/* 队列初始化 (容量向上取整到2的幂) */
+int spscQueueInit(spscQueue **pQueue, int capacity);
+
+/* 尝试入队 (只能由生产者线程调用, 队列满返回 INVALID_ACCESS) */
+int spscQueueTryPush(spscQueue *pQueue, ELEMENTTYPE val);
+
+/* 入队 (只能由生产者线程调用, 队列满时等待) */
+int spscQueuePush(spscQueue *pQueue, ELEMENTTYPE val);
+
+/* 尝试出队 (只能由消费者线程调用, 队列空返回 INVALID_ACCESS) */
+int spscQueueTryPop(spscQueue *pQueue, ELEMENTTYPE *pVal);
+
+/* 出队 (只能由消费者线程调用, 队列空时等待) */
+int spscQueuePop(spscQueue *pQueue, ELEMENTTYPE *pVal);
+
+/* 队列大小 (只是某一时刻的快照) */
+int spscQueueGetSize(spscQueue *pQueue, int *pSize);
+
+/* 队列销毁 (调用时不能有其他线程在使用) */
+int spscQueueDestroy(spscQueue *pQueue);
+
+/* 队列初始化 (容量向上取整到2的幂, 至少为2) */
+int mpmcQueueInit(mpmcQueue **pQueue, int capacity);
+
+/* 尝试入队 (线程安全, 队列满返回 INVALID_ACCESS) */
+int mpmcQueueTryPush(mpmcQueue *pQueue, ELEMENTTYPE val);
+
+/* 入队 (线程安全, 队列满时等待) */
+int mpmcQueuePush(mpmcQueue *pQueue, ELEMENTTYPE val);
+
+/* 尝试出队 (线程安全, 队列空返回 INVALID_ACCESS) */
+int mpmcQueueTryPop(mpmcQueue *pQueue, ELEMENTTYPE *pVal);
+
+/* 出队 (线程安全, 队列空时等待) */
+int mpmcQueuePop(mpmcQueue *pQueue, ELEMENTTYPE *pVal);
+
+/* 队列大小 (只是某一时刻的快照) */
+int mpmcQueueGetSize(mpmcQueue *pQueue, int *pSize);
+
+/* 队列销毁 (调用时不能有其他线程在使用) */
+int mpmcQueueDestroy(mpmcQueue *pQueue);
+
+#endif // __CONCURRENT_QUEUE_H_
@@ -18,6 +18,20 @@ enum STATUS_CODE
 static int DoubleLinkListAccordAppointValGetPos(DoubleLinkList * pList, ELEMENTTYPE val, int *pPos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
 /* 新建新结点封装成函数. */
 static DoubleLinkNode * createDoubleLinkNode(ELEMENTTYPE val);
+/* 找到 pos 位置的结点: 从头尾和跳跃索引中选最近的起点 */
+static DoubleLinkNode * DoubleLinkListGetNode(DoubleLinkList * pList, int pos);
+/* 找到 pos 位置的前一个结点 (pos 为0时是虚拟头结点) */
+static DoubleLinkNode * DoubleLinkListGetPrevNode(DoubleLinkList * pList, int pos);
+/* pos 及之后的位置发生变动: 让跳跃索引中受影响的项失效 */
+static void DoubleLinkListInvalidateSkipIndex(DoubleLinkList * pList, int pos);
+/* 把 [first, last] 这一段结点从链表中摘下来 */
+static void DoubleLinkListUnlinkRange(DoubleLinkList * pList, DoubleLinkNode *first, DoubleLinkNode *last, int num);
+/* 把 [first, last] 这一段结点挂到 prevNode 后面 */
+static void DoubleLinkListLinkRange(DoubleLinkList * pList, DoubleLinkNode *prevNode, DoubleLinkNode *first, DoubleLinkNode *last, int num);
+#ifndef NDEBUG
+/* 调试版本: 检查从 first 走到 last 正好是 num 个结点 */
+static int DoubleLinkListRangeLenMatch(DoubleLinkNode *first, DoubleLinkNode *last, int num);
+#endif
 
 /* 链表初始化 */
 int DoubleLinkListInit(DoubleLinkList **pList)
@@ -149,11 +163,8 @@ int DoubleLinkListAppointPosInsert(DoubleLinkList * pList, int pos, ELEMENTTYPE
     }
     else
     {
-        while (pos)
-        {
-            travelNode = travelNode->next;
-            pos--;
-        }
+        /* 从离得近的一端找到前一个结点 */
+        travelNode = DoubleLinkListGetPrevNode(pList, pos);
         travelNode->next->prev = newNode;       // 3    : 空链表 / 尾插
     }
     newNode->next = travelNode->next;       // 1
@@ -165,6 +176,7 @@ int DoubleLinkListAppointPosInsert(DoubleLinkList * pList, int pos, ELEMENTTYPE
         /* 尾指针更新位置 */
         pList->tail = newNode;
     }
+    DoubleLinkListInvalidateSkipIndex(pList, pos);
 
     /* 更新链表的长度 */
     (pList->len)++;
@@ -203,6 +215,7 @@ int DoubleLinkListDelAppointPos(DoubleLinkList * pList, int pos)
     DoubleLinkNode * travelNOde = pList->head->next;
 #endif 
     DoubleLinkNode * needDelNode = NULL;
+
     /* 需要修改尾指针 */
     if (pos == pList->len)
     {
@@ -214,11 +227,8 @@ int DoubleLinkListDelAppointPos(DoubleLinkList * pList, int pos)
     }
     else
     {
-        while (pos--)
-        {
-            /* 向后移动位置 */
-            travelNode = travelNode->next;
-        }   
+        /* 从离得近的一端找到前一个结点 */
+        travelNode = DoubleLinkListGetPrevNode(pList, pos);
         // 跳出循环找到的是哪一个结点？
         needDelNode = travelNode->next;                 // 1
         travelNode->next = needDelNode->next;           // 2
@@ -226,6 +236,12 @@ int DoubleLinkListDelAppointPos(DoubleLinkList * pList, int pos)
         {
             needDelNode->next->prev = travelNode;           // 3
         }
+        else
+        {
+            /* 这种问题是只有一个结点, 把这个结点删除之后也需要改动尾指针. */
+            /* 移动尾指针 */
+            pList->tail = pList->tail->prev;
+        }
     }
 
     /* 释放内存 */
@@ -234,6 +250,7 @@ int DoubleLinkListDelAppointPos(DoubleLinkList * pList, int pos)
         free(needDelNode);
         needDelNode = NULL;
     }
+    DoubleLinkListInvalidateSkipIndex(pList, pos);
 
     /* 链表长度减一 */
     (pList->len)--;
@@ -328,6 +345,12 @@ int DoubleLinkListDestroy(DoubleLinkList * pList)
         DoubleLinkListHeadDel(pList);
     }
 
+    if (pList->skipIndex != NULL)
+    {
+        free(pList->skipIndex);
+        pList->skipIndex = NULL;
+    }
+
     if (pList->head != NULL)
     {
         free(pList->head);
@@ -422,6 +445,10 @@ int DoubleLinkListGetHeadVal(DoubleLinkList * pList, ELEMENTTYPE *pVal)
     {
         return NULL_PTR;
     }
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
     if (pVal)
     {
         *pVal = pList->head->next->data;
@@ -432,11 +459,372 @@ int DoubleLinkListGetHeadVal(DoubleLinkList * pList, ELEMENTTYPE *pVal)
 /* 获取链表 尾位置值 */
 int DoubleLinkListGetTailVal(DoubleLinkList * pList, ELEMENTTYPE *pVal)
 {
-    return DoubleLinkListGetAppointPosVal(pList, pList->len, pVal);
+    return DoubleLinkListGetAppointPosVal(pList, pList->len - 1, pVal);
 }
 
 /* 获取链表 指定位置的值 */
 int DoubleLinkListGetAppointPosVal(DoubleLinkList * pList, int pos, ELEMENTTYPE *pVal)
 {
-    /* todo... */
-}
\ No newline at end of file
+    int ret = 0;
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pos < 0 || pos >= pList->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal)
+    {
+        *pVal = DoubleLinkListGetNode(pList, pos)->data;
+    }
+    return ret;
+}
+
+/* 找到 pos 位置的结点: 从头尾和跳跃索引中选最近的起点 */
+static DoubleLinkNode * DoubleLinkListGetNode(DoubleLinkList * pList, int pos)
+{
+    DoubleLinkNode * travelNode = NULL;
+    /* 从尾部往前走的步数 */
+    int fromTail = pList->len - 1 - pos;
+    int step = pList->skipStep;
+
+    if (step > 0)
+    {
+        int idx = pos / step;
+        int offset = pos - idx * step;
+        if (idx < pList->skipValidNum)
+        {
+            /* 下一项索引更近: 从它往前走 */
+            if (idx + 1 < pList->skipValidNum && step - offset < offset)
+            {
+                travelNode = pList->skipIndex[idx + 1];
+                for (int cnt = step - offset; cnt > 0; cnt--)
+                {
+                    travelNode = travelNode->prev;
+                }
+                return travelNode;
+            }
+            if (offset <= fromTail)
+            {
+                travelNode = pList->skipIndex[idx];
+                while (offset--)
+                {
+                    travelNode = travelNode->next;
+                }
+                return travelNode;
+            }
+        }
+        else
+        {
+            /* 索引还没建到这里: 从最后一个有效项往后走, 顺路补建索引 */
+            /* 虚拟头结点看作第 -1 个结点 */
+            int curPos = pList->skipValidNum > 0 ? (pList->skipValidNum - 1) * step : -1;
+            travelNode = pList->skipValidNum > 0 ? pList->skipIndex[pList->skipValidNum - 1] : pList->head;
+            if (pos - curPos <= fromTail)
+            {
+                if (idx >= pList->skipCapacity)
+                {
+                    int newCapacity = pList->len / step + 1;
+                    DoubleLinkNode ** newIndex = (DoubleLinkNode **)realloc(pList->skipIndex, sizeof(DoubleLinkNode *) * newCapacity);
+                    if (newIndex != NULL)
+                    {
+                        pList->skipIndex = newIndex;
+                        pList->skipCapacity = newCapacity;
+                    }
+                }
+
+                while (curPos < pos)
+                {
+                    travelNode = travelNode->next;
+                    curPos++;
+                    /* 申请索引空间失败时只遍历不记录 */
+                    if (curPos % step == 0 && curPos / step == pList->skipValidNum && pList->skipValidNum < pList->skipCapacity)
+                    {
+                        pList->skipIndex[pList->skipValidNum++] = travelNode;
+                    }
+                }
+                return travelNode;
+            }
+        }
+    }
+
+    if (pos <= fromTail)
+    {
+        /* 离头部更近: 往后走 */
+        travelNode = pList->head->next;
+        while (pos--)
+        {
+            travelNode = travelNode->next;
+        }
+    }
+    else
+    {
+        /* 离尾部更近: 沿着 prev 往前走 */
+        travelNode = pList->tail;
+        while (fromTail--)
+        {
+            travelNode = travelNode->prev;
+        }
+    }
+    return travelNode;
+}
+
+/* 找到 pos 位置的前一个结点 (pos 为0时是虚拟头结点) */
+static DoubleLinkNode * DoubleLinkListGetPrevNode(DoubleLinkList * pList, int pos)
+{
+    if (pos == 0)
+    {
+        return pList->head;
+    }
+    return DoubleLinkListGetNode(pList, pos - 1);
+}
+
+/* pos 及之后的位置发生变动: 让跳跃索引中受影响的项失效 */
+static void DoubleLinkListInvalidateSkipIndex(DoubleLinkList * pList, int pos)
+{
+    if (pList->skipStep <= 0)
+    {
+        return;
+    }
+
+    /* 第 i 项记录的是第 i * skipStep 个结点, 位置小于 pos 的项不受影响 */
+    int validNum = (pos + pList->skipStep - 1) / pList->skipStep;
+    if (validNum < pList->skipValidNum)
+    {
+        pList->skipValidNum = validNum;
+    }
+}
+
+/* 设置跳跃索引: 每 step 个结点记录一次, 按位置访问降到 O(n/step). step <= 0 时关闭 */
+int DoubleLinkListSetSkipIndex(DoubleLinkList * pList, int step)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->skipIndex != NULL)
+    {
+        free(pList->skipIndex);
+        pList->skipIndex = NULL;
+    }
+    pList->skipStep = step > 0 ? step : 0;
+    pList->skipValidNum = 0;
+    pList->skipCapacity = 0;
+    /* 索引在按位置访问时逐步建立 */
+    return ON_SUCCESS;
+}
+
+/* 把 [first, last] 这一段结点从链表中摘下来 */
+static void DoubleLinkListUnlinkRange(DoubleLinkList * pList, DoubleLinkNode *first, DoubleLinkNode *last, int num)
+{
+    first->prev->next = last->next;
+    if (last->next != NULL)
+    {
+        last->next->prev = first->prev;
+    }
+    else
+    {
+        /* 摘下的是最后一段: 移动尾指针 */
+        pList->tail = first->prev;
+    }
+    first->prev = NULL;
+    last->next = NULL;
+    pList->len -= num;
+}
+
+/* 把 [first, last] 这一段结点挂到 prevNode 后面 */
+static void DoubleLinkListLinkRange(DoubleLinkList * pList, DoubleLinkNode *prevNode, DoubleLinkNode *first, DoubleLinkNode *last, int num)
+{
+    last->next = prevNode->next;
+    if (prevNode->next != NULL)
+    {
+        prevNode->next->prev = last;
+    }
+    else
+    {
+        /* 挂在尾结点后面: 尾指针更新位置 */
+        pList->tail = last;
+    }
+    prevNode->next = first;
+    first->prev = prevNode;
+    pList->len += num;
+}
+
+#ifndef NDEBUG
+/* 调试版本: 检查从 first 走到 last 正好是 num 个结点 */
+static int DoubleLinkListRangeLenMatch(DoubleLinkNode *first, DoubleLinkNode *last, int num)
+{
+    int count = 1;
+    DoubleLinkNode * travelNode = first;
+    while (travelNode != last && travelNode != NULL && count <= num)
+    {
+        travelNode = travelNode->next;
+        count++;
+    }
+    return travelNode == last && count == num;
+}
+#endif
+
+/* 链表拼接: 把 pSrc 的所有结点接到 pDst 尾部 O(1), 拼接后 pSrc 为空 */
+int DoubleLinkListConcat(DoubleLinkList * pDst, DoubleLinkList * pSrc)
+{
+    if (pDst == NULL || pSrc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pDst == pSrc)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pSrc->len == 0)
+    {
+        return ON_SUCCESS;
+    }
+
+    DoubleLinkNode * first = pSrc->head->next;
+    DoubleLinkNode * last = pSrc->tail;
+    int num = pSrc->len;
+    DoubleLinkListUnlinkRange(pSrc, first, last, num);
+    DoubleLinkListLinkRange(pDst, pDst->tail, first, last, num);
+    DoubleLinkListInvalidateSkipIndex(pSrc, 0);
+    return ON_SUCCESS;
+}
+
+/* 链表拆分: 把 pos 位置开始到末尾的结点接到 pDst 尾部, 不申请新结点 */
+int DoubleLinkListSplitAt(DoubleLinkList * pList, int pos, DoubleLinkList * pDst)
+{
+    if (pList == NULL || pDst == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList == pDst || pos < 0 || pos > pList->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pos == pList->len)
+    {
+        return ON_SUCCESS;
+    }
+
+    DoubleLinkNode * first = DoubleLinkListGetPrevNode(pList, pos)->next;
+    DoubleLinkNode * last = pList->tail;
+    int num = pList->len - pos;
+    DoubleLinkListUnlinkRange(pList, first, last, num);
+    DoubleLinkListLinkRange(pDst, pDst->tail, first, last, num);
+    DoubleLinkListInvalidateSkipIndex(pList, pos);
+    return ON_SUCCESS;
+}
+
+/* 结点搬移: 把 pSrc 从 srcPos 开始的 num 个结点移动到 pDst 的 dstPos 位置, 不申请新结点 */
+int DoubleLinkListSplice(DoubleLinkList * pDst, int dstPos, DoubleLinkList * pSrc, int srcPos, int num)
+{
+    if (pDst == NULL || pSrc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 同一个链表内的搬移位置有歧义, 不支持 */
+    if (pDst == pSrc)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (num < 0 || srcPos < 0 || srcPos + num > pSrc->len || dstPos < 0 || dstPos > pDst->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (num == 0)
+    {
+        return ON_SUCCESS;
+    }
+
+    DoubleLinkNode * first = DoubleLinkListGetNode(pSrc, srcPos);
+    DoubleLinkNode * last = DoubleLinkListGetNode(pSrc, srcPos + num - 1);
+
+    /* 插入位置在末尾时不需要遍历 */
+    DoubleLinkNode * prevNode = (dstPos == pDst->len) ? pDst->tail : DoubleLinkListGetPrevNode(pDst, dstPos);
+    DoubleLinkListUnlinkRange(pSrc, first, last, num);
+    DoubleLinkListLinkRange(pDst, prevNode, first, last, num);
+    DoubleLinkListInvalidateSkipIndex(pSrc, srcPos);
+    DoubleLinkListInvalidateSkipIndex(pDst, dstPos);
+    return ON_SUCCESS;
+}
+
+/* 链表拆分 (按结点): 把 node 开始到末尾的 num 个结点接到 pDst 尾部 O(1), num 由调用者给出 (必须等于 node 到末尾的结点个数, 调试版本会核对) */
+int DoubleLinkListSplitAtNode(DoubleLinkList * pList, DoubleLinkNode *node, int num, DoubleLinkList * pDst)
+{
+    if (pList == NULL || node == NULL || pDst == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList == pDst || node == pList->head || num <= 0 || num > pList->len)
+    {
+        return INVALID_ACCESS;
+    }
+#ifndef NDEBUG
+    /* num 不对会把两个链表的长度弄乱, 调试版本走一遍核对 */
+    if (!DoubleLinkListRangeLenMatch(node, pList->tail, num))
+    {
+        return INVALID_ACCESS;
+    }
+#endif
+
+    DoubleLinkNode * last = pList->tail;
+    DoubleLinkListUnlinkRange(pList, node, last, num);
+    DoubleLinkListLinkRange(pDst, pDst->tail, node, last, num);
+    /* node 原来的位置就是剩下的长度 */
+    DoubleLinkListInvalidateSkipIndex(pList, pList->len);
+    return ON_SUCCESS;
+}
+
+/*
+ * 结点搬移 (按结点): 把 pSrc 中 [first, last] 这 num 个结点移动到 pDst 的 prevNode 后面 O(1).
+ * prevNode 为 pDst->head 时插到头部. pDst 和 pSrc 可以是同一个链表, 此时 prevNode 不能在 [first, last] 中.
+ * num 必须等于 [first, last] 的结点个数 (调试版本会核对, 不符时返回 INVALID_ACCESS)
+ */
+int DoubleLinkListSpliceNodes(DoubleLinkList * pDst, DoubleLinkNode *prevNode, DoubleLinkList * pSrc, DoubleLinkNode *first, DoubleLinkNode *last, int num)
+{
+    if (pDst == NULL || prevNode == NULL || pSrc == NULL || first == NULL || last == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (first == pSrc->head || num <= 0 || num > pSrc->len)
+    {
+        return INVALID_ACCESS;
+    }
+#ifndef NDEBUG
+    if (!DoubleLinkListRangeLenMatch(first, last, num))
+    {
+        return INVALID_ACCESS;
+    }
+#endif
+
+    /* 已经在 prevNode 后面, 不需要搬移 */
+    if (prevNode == first->prev)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 挂在尾结点后面时 pDst 已有结点的位置不变 */
+    int appendTail = (prevNode == pDst->tail && pDst != pSrc);
+    DoubleLinkListUnlinkRange(pSrc, first, last, num);
+    DoubleLinkListLinkRange(pDst, prevNode, first, last, num);
+    /* 按结点操作不知道位置: 跳跃索引整体失效 */
+    DoubleLinkListInvalidateSkipIndex(pSrc, 0);
+    if (!appendTail)
+    {
+        DoubleLinkListInvalidateSkipIndex(pDst, 0);
+    }
+    return ON_SUCCESS;
+}
@@ -1,6 +1,315 @@
 #include "doubleLinkListQueue.h"
 #include "doubleLinkList.h"
+#include <stdlib.h>
+#include <string.h>
 
+#if DOUBLE_LINK_LIST_QUEUE_USE_ARRAY
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 下标回绕 (容量是2的幂, 用掩码代替取余) */
+#define QUEUE_INDEX(pQueue, idx)    ((idx) & ((pQueue)->capacity - 1))
+
+/* 静态前置声明 */
+static int expandDoubleLinkListQueue(DoubleLinkListQueue *pQueue, int needCapacity);
+static void copyOutDoubleLinkListQueue(DoubleLinkListQueue *pQueue, ELEMENTTYPE *buf, int num);
+
+/* 扩容: 容量翻倍直到放得下 needCapacity 个元素, 元素按队列顺序搬到新空间的开头 */
+static int expandDoubleLinkListQueue(DoubleLinkListQueue *pQueue, int needCapacity)
+{
+    int newCapacity = pQueue->capacity * 2;
+    while (newCapacity < needCapacity)
+    {
+        newCapacity *= 2;
+    }
+    ELEMENTTYPE *newData = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * newCapacity);
+    if (newData == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+
+    copyOutDoubleLinkListQueue(pQueue, newData, pQueue->len);
+
+    free(pQueue->data);
+    pQueue->data = newData;
+    pQueue->capacity = newCapacity;
+    pQueue->front = 0;
+    return ON_SUCCESS;
+}
+
+/* 从队头开始按顺序拷贝 num 个元素到 buf (不出队) */
+static void copyOutDoubleLinkListQueue(DoubleLinkListQueue *pQueue, ELEMENTTYPE *buf, int num)
+{
+    /* 队头到数组末尾的一段 + 数组开头回绕的一段 */
+    int firstNum = pQueue->capacity - pQueue->front;
+    if (firstNum > num)
+    {
+        firstNum = num;
+    }
+    memcpy(buf, pQueue->data + pQueue->front, sizeof(ELEMENTTYPE) * firstNum);
+    memcpy(buf + firstNum, pQueue->data, sizeof(ELEMENTTYPE) * (num - firstNum));
+}
+
+/* 队列初始化 */
+int doubleLinkListQueueInit(DoubleLinkListQueue **pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    DoubleLinkListQueue *queue = (DoubleLinkListQueue *)malloc(sizeof(DoubleLinkListQueue));
+    if (queue == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(queue, 0, sizeof(DoubleLinkListQueue));
+
+    queue->data = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * DOUBLE_LINK_LIST_QUEUE_INIT_CAPACITY);
+    if (queue->data == NULL)
+    {
+        free(queue);
+        return MALLOC_ERROR;
+    }
+    queue->capacity = DOUBLE_LINK_LIST_QUEUE_INIT_CAPACITY;
+    queue->front = 0;
+    queue->len = 0;
+
+    *pQueue = queue;
+    return ON_SUCCESS;
+}
+
+/* 队列入队 */
+int doubleLinkListQueuePush(DoubleLinkListQueue *pQueue, ELEMENTTYPE val)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->len == pQueue->capacity)
+    {
+        int ret = expandDoubleLinkListQueue(pQueue, pQueue->len + 1);
+        if (ret != ON_SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    pQueue->data[QUEUE_INDEX(pQueue, pQueue->front + pQueue->len)] = val;
+    (pQueue->len)++;
+    return ON_SUCCESS;
+}
+
+/* 队头元素 */
+int doubleLinkListQueueTop(DoubleLinkListQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal)
+    {
+        *pVal = pQueue->data[pQueue->front];
+    }
+    return ON_SUCCESS;
+}
+
+/* 队尾元素 */
+int doubleLinkListQueueRear(DoubleLinkListQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal)
+    {
+        *pVal = pQueue->data[QUEUE_INDEX(pQueue, pQueue->front + pQueue->len - 1)];
+    }
+    return ON_SUCCESS;
+}
+
+/* 队列出队 */
+int doubleLinkListQueuePop(DoubleLinkListQueue *pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    pQueue->front = QUEUE_INDEX(pQueue, pQueue->front + 1);
+    (pQueue->len)--;
+    return ON_SUCCESS;
+}
+
+/* 队列大小 */
+int doubleLinkListQueueGetSize(DoubleLinkListQueue *pQueue, int *pSize)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pSize)
+    {
+        *pSize = pQueue->len;
+    }
+    return pQueue->len;
+}
+
+/* 队列是否为空 */
+int doubleLinkListQueueIsEmpty(DoubleLinkListQueue *pQueue)
+{
+    int size = 0;
+    doubleLinkListQueueGetSize(pQueue, &size);
+    return size == 0 ? 1 : 0;
+}
+
+/* 队列销毁*/
+int doubleLinkListQueueDestroy(DoubleLinkListQueue *pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->data != NULL)
+    {
+        free(pQueue->data);
+        pQueue->data = NULL;
+    }
+    free(pQueue);
+    return ON_SUCCESS;
+}
+
+/* 批量入队: vals 中的 num 个元素依次入队 */
+int doubleLinkListQueuePushBatch(DoubleLinkListQueue *pQueue, ELEMENTTYPE *vals, int num)
+{
+    if (pQueue == NULL || vals == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (num < 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    /* 一次扩容到位 */
+    if (pQueue->len + num > pQueue->capacity)
+    {
+        int ret = expandDoubleLinkListQueue(pQueue, pQueue->len + num);
+        if (ret != ON_SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    /* 队尾到数组末尾的一段 + 数组开头回绕的一段 */
+    int rear = QUEUE_INDEX(pQueue, pQueue->front + pQueue->len);
+    int firstNum = pQueue->capacity - rear;
+    if (firstNum > num)
+    {
+        firstNum = num;
+    }
+    memcpy(pQueue->data + rear, vals, sizeof(ELEMENTTYPE) * firstNum);
+    memcpy(pQueue->data, vals + firstNum, sizeof(ELEMENTTYPE) * (num - firstNum));
+    pQueue->len += num;
+    return ON_SUCCESS;
+}
+
+/* 批量出队: 最多取出 max 个元素放到 buf 里, 实际个数放到 *pPopNum */
+int doubleLinkListQueuePopBatch(DoubleLinkListQueue *pQueue, ELEMENTTYPE *buf, int max, int *pPopNum)
+{
+    if (pQueue == NULL || buf == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (max < 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    int popNum = max < pQueue->len ? max : pQueue->len;
+    copyOutDoubleLinkListQueue(pQueue, buf, popNum);
+    pQueue->front = QUEUE_INDEX(pQueue, pQueue->front + popNum);
+    pQueue->len -= popNum;
+
+    if (pPopNum != NULL)
+    {
+        *pPopNum = popNum;
+    }
+    return ON_SUCCESS;
+}
+
+/* 整体取走: 把队列里的所有元素按顺序接到 pDst 队尾, 之后 pQueue 为空 (pDst 为空时 O(1)) */
+int doubleLinkListQueueDrain(DoubleLinkListQueue *pQueue, DoubleLinkListQueue *pDst)
+{
+    if (pQueue == NULL || pDst == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue == pDst)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pDst->len == 0)
+    {
+        /* 目标为空: 直接交换两个队列的数组 */
+        DoubleLinkListQueue tmpQueue = *pDst;
+        *pDst = *pQueue;
+        *pQueue = tmpQueue;
+        pQueue->front = 0;
+        return ON_SUCCESS;
+    }
+
+    /* 目标不为空: 直接拷贝到目标的数组里 */
+    if (pDst->len + pQueue->len > pDst->capacity)
+    {
+        int ret = expandDoubleLinkListQueue(pDst, pDst->len + pQueue->len);
+        if (ret != ON_SUCCESS)
+        {
+            return ret;
+        }
+    }
+    for (int idx = 0; idx < pQueue->len; idx++)
+    {
+        pDst->data[QUEUE_INDEX(pDst, pDst->front + pDst->len + idx)] = pQueue->data[QUEUE_INDEX(pQueue, pQueue->front + idx)];
+    }
+    pDst->len += pQueue->len;
+    pQueue->front = 0;
+    pQueue->len = 0;
+    return ON_SUCCESS;
+}
+#else
 /* 队列初始化 */
 int doubleLinkListQueueInit(DoubleLinkListQueue **pQueue)
 {
@@ -49,4 +358,50 @@ int doubleLinkListQueueIsEmpty(DoubleLinkListQueue *pQueue)
 int doubleLinkListQueueDestroy(DoubleLinkListQueue *pQueue)
 {
     return DoubleLinkListDestroy(pQueue);
-}
\ No newline at end of file
+}
+
+/* 批量入队: vals 中的 num 个元素依次入队 */
+int doubleLinkListQueuePushBatch(DoubleLinkListQueue *pQueue, ELEMENTTYPE *vals, int num)
+{
+    int ret = 0;
+    for (int idx = 0; idx < num; idx++)
+    {
+        ret = DoubleLinkListTailInsert(pQueue, vals[idx]);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+    return ret;
+}
+
+/* 批量出队: 最多取出 max 个元素放到 buf 里, 实际个数放到 *pPopNum */
+int doubleLinkListQueuePopBatch(DoubleLinkListQueue *pQueue, ELEMENTTYPE *buf, int max, int *pPopNum)
+{
+    int ret = 0;
+    int popNum = 0;
+    while (popNum < max && DoubleLinkListGetLength(pQueue, NULL) > 0)
+    {
+        DoubleLinkListGetHeadVal(pQueue, &buf[popNum]);
+        ret = DoubleLinkListHeadDel(pQueue);
+        if (ret != 0)
+        {
+            break;
+        }
+        popNum++;
+    }
+
+    if (pPopNum != NULL)
+    {
+        *pPopNum = popNum;
+    }
+    return ret;
+}
+
+/* 整体取走: 把队列里的所有元素按顺序接到 pDst 队尾, 之后 pQueue 为空 (pDst 为空时 O(1)) */
+int doubleLinkListQueueDrain(DoubleLinkListQueue *pQueue, DoubleLinkListQueue *pDst)
+{
+    /* 链表实现: 整条结点链直接转移, 任何情况都是 O(1) */
+    return DoubleLinkListConcat(pDst, pQueue);
+}
+#endif
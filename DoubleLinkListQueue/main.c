@@ -1,10 +1,179 @@
 #include "doubleLinkListQueue.h"
+#include "doubleLinkList.h"
+#include "concurrentQueue.h"
 #include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
 
 #define BUFFER_SIZE 5
 
+/* 置1: 运行生产者-消费者吞吐量/延迟测试 */
+#define RUN_QUEUE_BENCH         0
+
+#if RUN_QUEUE_BENCH
+/* 生产者-消费者测试: 元素里放入队时刻, 出队时统计延迟 */
+#define BENCH_ITEM_NUM          1000000
+#define BENCH_QUEUE_CAPACITY    1024
+#define BENCH_MPMC_THREAD_NUM   2
+
+static DoubleLinkList *g_lockList = NULL;
+static pthread_mutex_t g_queueMutex = PTHREAD_MUTEX_INITIALIZER;
+static spscQueue *g_spscQueue = NULL;
+static mpmcQueue *g_mpmcQueue = NULL;
+
+/* 队列操作 */
+typedef struct queueBenchOps
+{
+    /* 入队 (阻塞) */
+    int (*push)(ELEMENTTYPE val);
+    /* 尝试出队, 成功返回0 */
+    int (*tryPop)(ELEMENTTYPE *pVal);
+} queueBenchOps;
+
+/* 测试参数和结果 */
+typedef struct queueBenchArg
+{
+    queueBenchOps *ops;
+    /* 生产者: 要入队的个数 */
+    long itemNum;
+    /* 消费者: 所有消费者一起出队的个数 */
+    _Atomic long *pConsumed;
+    long totalNum;
+    /* 消费者: 延迟总和(纳秒) */
+    double latencySum;
+} queueBenchArg;
+
+static long benchNowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000L + now.tv_nsec;
+}
+
+/* 互斥锁包装的双向链表 */
+static int lockListPush(ELEMENTTYPE val)
+{
+    pthread_mutex_lock(&g_queueMutex);
+    int ret = DoubleLinkListTailInsert(g_lockList, val);
+    pthread_mutex_unlock(&g_queueMutex);
+    return ret;
+}
+
+static int lockListTryPop(ELEMENTTYPE *pVal)
+{
+    int ret = -1;
+    pthread_mutex_lock(&g_queueMutex);
+    if (DoubleLinkListGetLength(g_lockList, NULL) > 0)
+    {
+        DoubleLinkListGetHeadVal(g_lockList, pVal);
+        ret = DoubleLinkListHeadDel(g_lockList);
+    }
+    pthread_mutex_unlock(&g_queueMutex);
+    return ret;
+}
+
+static int spscPush(ELEMENTTYPE val)
+{
+    return spscQueuePush(g_spscQueue, val);
+}
+
+static int spscTryPop(ELEMENTTYPE *pVal)
+{
+    return spscQueueTryPop(g_spscQueue, pVal);
+}
+
+static int mpmcPush(ELEMENTTYPE val)
+{
+    return mpmcQueuePush(g_mpmcQueue, val);
+}
+
+static int mpmcTryPop(ELEMENTTYPE *pVal)
+{
+    return mpmcQueueTryPop(g_mpmcQueue, pVal);
+}
+
+static void * benchProducerRoutine(void *arg)
+{
+    queueBenchArg *benchArg = (queueBenchArg *)arg;
+    for (long idx = 0; idx < benchArg->itemNum; idx++)
+    {
+        benchArg->ops->push((ELEMENTTYPE)benchNowNs());
+    }
+    return NULL;
+}
+
+static void * benchConsumerRoutine(void *arg)
+{
+    queueBenchArg *benchArg = (queueBenchArg *)arg;
+    ELEMENTTYPE val = NULL;
+    while (atomic_load(benchArg->pConsumed) < benchArg->totalNum)
+    {
+        if (benchArg->ops->tryPop(&val) != 0)
+        {
+            sched_yield();
+            continue;
+        }
+        benchArg->latencySum += benchNowNs() - (long)val;
+        atomic_fetch_add(benchArg->pConsumed, 1);
+    }
+    return NULL;
+}
+
+/* threadNum 个生产者 + threadNum 个消费者 */
+static void runQueueBench(const char *name, queueBenchOps *ops, int threadNum)
+{
+    pthread_t producers[BENCH_MPMC_THREAD_NUM];
+    pthread_t consumers[BENCH_MPMC_THREAD_NUM];
+    queueBenchArg producerArgs[BENCH_MPMC_THREAD_NUM];
+    queueBenchArg consumerArgs[BENCH_MPMC_THREAD_NUM];
+    _Atomic long consumed = 0;
+
+    long begin = benchNowNs();
+    for (int idx = 0; idx < threadNum; idx++)
+    {
+        consumerArgs[idx] = (queueBenchArg){ops, 0, &consumed, BENCH_ITEM_NUM, 0};
+        pthread_create(&consumers[idx], NULL, benchConsumerRoutine, &consumerArgs[idx]);
+    }
+    for (int idx = 0; idx < threadNum; idx++)
+    {
+        producerArgs[idx] = (queueBenchArg){ops, BENCH_ITEM_NUM / threadNum, NULL, 0, 0};
+        pthread_create(&producers[idx], NULL, benchProducerRoutine, &producerArgs[idx]);
+    }
+    double latencySum = 0;
+    for (int idx = 0; idx < threadNum; idx++)
+    {
+        pthread_join(producers[idx], NULL);
+        pthread_join(consumers[idx], NULL);
+        latencySum += consumerArgs[idx].latencySum;
+    }
+    double cost = (benchNowNs() - begin) / 1e9;
+
+    printf("%-12s %dP%dC: %.3fs\t%.2f Mops/s\tavg latency %.0fns\n", name, threadNum, threadNum, cost, BENCH_ITEM_NUM / cost / 1e6, latencySum / BENCH_ITEM_NUM);
+}
+#endif
+
 int main()
 {
+#if RUN_QUEUE_BENCH
+    DoubleLinkListInit(&g_lockList);
+    spscQueueInit(&g_spscQueue, BENCH_QUEUE_CAPACITY);
+    mpmcQueueInit(&g_mpmcQueue, BENCH_QUEUE_CAPACITY);
+
+    queueBenchOps lockOps = {lockListPush, lockListTryPop};
+    queueBenchOps spscOps = {spscPush, spscTryPop};
+    queueBenchOps mpmcOps = {mpmcPush, mpmcTryPop};
+
+    runQueueBench("mutex list", &lockOps, 1);
+    runQueueBench("spsc ring", &spscOps, 1);
+    runQueueBench("mpmc ring", &mpmcOps, 1);
+    runQueueBench("mutex list", &lockOps, BENCH_MPMC_THREAD_NUM);
+    runQueueBench("mpmc ring", &mpmcOps, BENCH_MPMC_THREAD_NUM);
+
+    DoubleLinkListDestroy(g_lockList);
+    spscQueueDestroy(g_spscQueue);
+    mpmcQueueDestroy(g_mpmcQueue);
+#else
     DoubleLinkListQueue *queue = NULL;
     doubleLinkListQueueInit(&queue);
 
@@ -45,6 +214,7 @@ int main()
 
     /* 销毁队列 */
     doubleLinkListQueueDestroy(queue);
+#endif
 #endif
     return 0;
 }
\ No newline at end of file
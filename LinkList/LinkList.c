@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <assert.h>
 
 /* 状态码 */
 enum STATUS_CODE
@@ -15,12 +16,146 @@ enum STATUS_CODE
 
 /* 静态函数只在本源文件(.c)使用 */
 /* 静态前置声明 */
-static int LinkListAccordAppointValGetPos(LinkList * pList, ELEMENTTYPE val, int *pPos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+static int LinkListInitAttr(LinkList **pList, LinkNodePool *pool, int ownPool);
+static LinkNode * allocLinkNode(LinkNodePool *pool);
+static void freeLinkNode(LinkNodePool *pool, LinkNode *node);
+static int LinkListCompareEqual(ELEMENTTYPE data, void *arg);
+static LinkNode * mergeLinkNodeChain(LinkNode *left, LinkNode *right, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE), LinkNode **pTail);
+static int mergeHeapLess(LinkNode **heapNodes, int *heapIdx, int idx1, int idx2, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+static void mergeHeapSiftDown(LinkNode **heapNodes, int *heapIdx, int heapSize, int pos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+
+/* 按值删除时传给 LinkListRemoveIf 的参数 */
+typedef struct LinkListCompareCtx
+{
+    ELEMENTTYPE val;
+    int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE);
+} LinkListCompareCtx;
+
+/* 结点池初始化 (blockSize <= 0 时使用默认大小) */
+int LinkNodePoolInit(LinkNodePool **pPool, int blockSize)
+{
+    if (pPool == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (blockSize <= 0)
+    {
+        blockSize = LINK_NODE_POOL_DEFAULT_BLOCK_SIZE;
+    }
+
+    LinkNodePool *pool = (LinkNodePool *)malloc(sizeof(LinkNodePool) * 1);
+    if (pool == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(pool, 0, sizeof(LinkNodePool) * 1);
+    pool->blocks = NULL;
+    pool->freeList = NULL;
+    /* 还没有块: 当作当前块已经用完 */
+    pool->blockUsed = blockSize;
+    pool->blockSize = blockSize;
+
+    *pPool = pool;
+    return ON_SUCCESS;
+}
+
+/* 结点池销毁: 一次释放所有的块 */
+int LinkNodePoolDestroy(LinkNodePool *pPool)
+{
+    if (pPool == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    LinkNodeBlock *block = pPool->blocks;
+    while (block != NULL)
+    {
+        LinkNodeBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(pPool);
+    return ON_SUCCESS;
+}
+
+/* 从结点池申请结点 */
+static LinkNode * allocLinkNode(LinkNodePool *pool)
+{
+    LinkNode *node = NULL;
+    if (pool->freeList != NULL)
+    {
+        /* 优先复用空闲结点 */
+        node = pool->freeList;
+        pool->freeList = node->next;
+    }
+    else
+    {
+        /* 当前块用完了: 申请新的块 */
+        if (pool->blockUsed == pool->blockSize)
+        {
+            LinkNodeBlock *block = (LinkNodeBlock *)malloc(sizeof(LinkNodeBlock) + sizeof(LinkNode) * pool->blockSize);
+            if (block == NULL)
+            {
+                return NULL;
+            }
+            block->next = pool->blocks;
+            pool->blocks = block;
+            pool->blockUsed = 0;
+        }
+        node = &pool->blocks->nodes[(pool->blockUsed)++];
+    }
+
+    node->data = 0;
+    node->next = NULL;
+    return node;
+}
+
+/* 结点还给结点池 */
+static void freeLinkNode(LinkNodePool *pool, LinkNode *node)
+{
+    node->next = pool->freeList;
+    pool->freeList = node;
+}
 
 /* 链表初始化 */
 int LinkListInit(LinkList **pList)
+{
+    LinkNodePool *pool = NULL;
+    int ret = LinkNodePoolInit(&pool, 0);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+
+    ret = LinkListInitAttr(pList, pool, 1);
+    if (ret != ON_SUCCESS)
+    {
+        LinkNodePoolDestroy(pool);
+    }
+    return ret;
+}
+
+/* 链表初始化: 使用共享的结点池 (结点池要在所有使用它的链表销毁之后再销毁) */
+int LinkListInitWithPool(LinkList **pList, LinkNodePool *pool)
+{
+    if (pool == NULL)
+    {
+        return NULL_PTR;
+    }
+    return LinkListInitAttr(pList, pool, 0);
+}
+
+/* 链表初始化: 申请链表和虚拟头结点 */
+static int LinkListInitAttr(LinkList **pList, LinkNodePool *pool, int ownPool)
 {
     int ret = 0;
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
     LinkList *list = (LinkList *)malloc(sizeof(LinkList) * 1);
     if (list == NULL)
     {
@@ -32,6 +167,7 @@ int LinkListInit(LinkList **pList)
     list->head = (LinkNode *)malloc(sizeof(LinkNode) * 1);
     if (list->head == NULL)
     {
+        free(list);
         return MALLOC_ERROR;
     }
     /* 清空脏数据 */
@@ -44,6 +180,9 @@ int LinkListInit(LinkList **pList)
     /* 链表的长度为0 */
     list->len = 0;
 
+    list->pool = pool;
+    list->ownPool = ownPool;
+
     /* 二级指针 */
     *pList = list;
     return ret;
@@ -55,11 +194,101 @@ int LinkListHeadInsert(LinkList * pList, ELEMENTTYPE val)
     return LinkListAppointPosInsert(pList, 0, val);
 }
 
-/* 链表尾插 */
+/* 链表尾插 O(1) */
 int LinkListTailInsert(LinkList * pList, ELEMENTTYPE val)
 {
-    /* todo... */
-    return LinkListAppointPosInsert(pList, pList->len, val);
+    return LinkListPushBack(pList, val);
+}
+
+/* 队尾入队 O(1): 直接挂在尾指针后面, 不需要遍历 */
+int LinkListPushBack(LinkList * pList, ELEMENTTYPE val)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    LinkNode * newNode = allocLinkNode(pList->pool);
+    if (newNode == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    newNode->data = val;
+
+    pList->tail->next = newNode;
+    pList->tail = newNode;
+    (pList->len)++;
+    return ON_SUCCESS;
+}
+
+/* 队头出队 O(1): 取出第一个元素 */
+int LinkListPopFront(LinkList * pList, ELEMENTTYPE *pVal)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    LinkNode * needDelNode = pList->head->next;
+    pList->head->next = needDelNode->next;
+    /* 删除的是最后一个结点: 尾指针回到虚拟头结点 */
+    if (needDelNode == pList->tail)
+    {
+        pList->tail = pList->head;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = needDelNode->data;
+    }
+    freeLinkNode(pList->pool, needDelNode);
+    (pList->len)--;
+    return ON_SUCCESS;
+}
+
+/* 获取链表 头位置值 O(1) */
+int LinkListGetHeadVal(LinkList * pList, ELEMENTTYPE *pVal)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pList->head->next->data;
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取链表 尾位置值 O(1) */
+int LinkListGetTailVal(LinkList * pList, ELEMENTTYPE *pVal)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pList->tail->data;
+    }
+    return ON_SUCCESS;
 }
 
 /* 链表指定位置插入 */
@@ -76,18 +305,12 @@ int LinkListAppointPosInsert(LinkList * pList, int pos, ELEMENTTYPE val)
         return INVALID_ACCESS;
     }
 
-    /* 封装结点 */
-    LinkNode * newNode = (LinkNode *)malloc(sizeof(LinkNode) * 1);
+    /* 封装结点 (从结点池中申请) */
+    LinkNode * newNode = allocLinkNode(pList->pool);
     if (newNode == NULL)
     {
         return MALLOC_ERROR;
     }
-    /* 清除脏数据 */
-    memset(newNode, 0, sizeof(LinkNode) * 1);
-#if 1
-    newNode->data = 0;
-    newNode->next = NULL;
-#endif
     /* 赋值 */
     newNode->data = val;
 
@@ -131,15 +354,19 @@ int LinkListAppointPosInsert(LinkList * pList, int pos, ELEMENTTYPE val)
     return ret;
 }
 
-/* 链表头删 */
+/* 链表头删 O(1) */
 int LinkListHeadDel(LinkList * pList)
 {
-    return LinkListDelAppointPos(pList, 0);
+    return LinkListPopFront(pList, NULL);
 }
 
-/* 链表尾删 */
+/* 链表尾删 O(n): 单链表找不到尾结点的前一个结点, 只能从头遍历 */
 int LinkListTailDel(LinkList * pList)
 {
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
     return LinkListDelAppointPos(pList, pList->len - 1);
 }
 
@@ -164,8 +391,8 @@ int LinkListDelAppointPos(LinkList * pList, int pos)
 #endif 
 
     int flag = 0;
-    /* 需要修改尾指针 */
-    if (pos == pList->len)
+    /* 删除的是最后一个结点: 需要修改尾指针 */
+    if (pos == pList->len - 1)
     {
         /* 需要修改尾指针 */
         flag = 1;
@@ -186,10 +413,10 @@ int LinkListDelAppointPos(LinkList * pList, int pos)
         pList->tail = travelNode;
     }
 
-    /* 释放内存 */
+    /* 结点还给结点池 */
     if (needDelNode != NULL)
     {
-        free(needDelNode);
+        freeLinkNode(pList->pool, needDelNode);
         needDelNode = NULL;
     }
 
@@ -198,63 +425,291 @@ int LinkListDelAppointPos(LinkList * pList, int pos)
     return ret;
 }
 
-/* 根据指定的元素得到在链表中所在的位置 */
-static int LinkListAccordAppointValGetPos(LinkList * pList, ELEMENTTYPE val, int *pPos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+/* 链表删除指定的数据 */
+int LinkListDelAppointData(LinkList * pList, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
 {
-    /* 静态函数只给本源文件的函数使用, 不需要判断合法性 */
-    int ret;
-    
-#if 0
-    int pos = 0;
-    LinkNode *travelNode = pList->head;
-#else
-    int pos = 0;
-    LinkNode *travelNode = pList->head->next;
-#endif
-    
-    int cmp = 0;
+    int ret = 0;
+    if (compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+    /* 一次遍历删除所有匹配的结点 */
+    LinkListCompareCtx ctx = {val, compareFunc};
+    ret = LinkListRemoveIf(pList, LinkListCompareEqual, &ctx, NULL, NULL);
+    return ret;
+}
+
+/* 按值删除时传给 LinkListRemoveIf 的参数 */
+static int LinkListCompareEqual(ELEMENTTYPE data, void *arg)
+{
+    LinkListCompareCtx *ctx = (LinkListCompareCtx *)arg;
+    return ctx->compareFunc(ctx->val, data) == 0;
+}
+
+/* 链表删除满足条件的结点 (一次遍历, 边遍历边摘除). destroyFunc 不为NULL时用来释放被删除的数据 */
+int LinkListRemoveIf(LinkList * pList, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum)
+{
+    if (pList == NULL || predicate == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int removeNum = 0;
+    /* prevNode 始终是 travelNode 的前一个结点 */
+    LinkNode * prevNode = pList->head;
+    LinkNode * travelNode = pList->head->next;
     while (travelNode != NULL)
     {
-        #if 0
-        if (travelNode->data == val)
+        LinkNode * nextNode = travelNode->next;
+        if (predicate(travelNode->data, ctx))
+        {
+            /* 摘除结点 */
+            prevNode->next = nextNode;
+            if (destroyFunc != NULL)
+            {
+                destroyFunc(travelNode->data);
+            }
+            freeLinkNode(pList->pool, travelNode);
+            removeNum++;
+        }
+        else
+        {
+            prevNode = travelNode;
+        }
+        travelNode = nextNode;
+    }
+
+    /* 尾指针指向最后一个保留的结点 */
+    pList->tail = prevNode;
+    pList->len -= removeNum;
+
+    if (pRemoveNum != NULL)
+    {
+        *pRemoveNum = removeNum;
+    }
+    return ON_SUCCESS;
+}
+
+/* 合并两条有序的结点链 (以NULL结尾). 相等时先取 left 的结点, 保证稳定 */
+static LinkNode * mergeLinkNodeChain(LinkNode *left, LinkNode *right, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE), LinkNode **pTail)
+{
+    LinkNode dummy;
+    LinkNode *tail = &dummy;
+    while (left != NULL && right != NULL)
+    {
+        if (compareFunc(right->data, left->data) < 0)
+        {
+            tail->next = right;
+            right = right->next;
+        }
+        else
         {
-            /* 解引用 */
-            *pPos = pos;
-            return pos;
+            tail->next = left;
+            left = left->next;
         }
-        #else
-        cmp = compareFunc(val, travelNode->data);
-        if (cmp == 0)
+        tail = tail->next;
+    }
+    tail->next = (left != NULL) ? left : right;
+
+    if (pTail != NULL)
+    {
+        while (tail->next != NULL)
         {
-            /* 解引用 */
-            *pPos = pos;
-            return pos;
+            tail = tail->next;
         }
-        #endif
+        *pTail = tail;
+    }
+    return dummy.next;
+}
+
+/* 归并排序的桶个数: 第 k 个桶存放长度为 2^k 的有序链 */
+#define LINK_LIST_SORT_BINS    64
+
+/* 链表排序: 原地, 稳定的自底向上归并排序 O(nlogn). compareFunc 返回 <0, 0, >0 */
+int LinkListSort(LinkList * pList, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+{
+    if (pList == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len <= 1)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 结点逐个摘下来放进桶里, 同长度的链两两合并 (类似二进制进位). 桶里的链总比后来的结点靠前 */
+    LinkNode *bins[LINK_LIST_SORT_BINS] = {NULL};
+    int maxBin = 0;
+    LinkNode *travelNode = pList->head->next;
+    while (travelNode != NULL)
+    {
+        LinkNode *carry = travelNode;
         travelNode = travelNode->next;
-        pos++;
+        carry->next = NULL;
+
+        int idx = 0;
+        while (idx < LINK_LIST_SORT_BINS - 1 && bins[idx] != NULL)
+        {
+            carry = mergeLinkNodeChain(bins[idx], carry, compareFunc, NULL);
+            bins[idx] = NULL;
+            idx++;
+        }
+        bins[idx] = carry;
+        if (idx > maxBin)
+        {
+            maxBin = idx;
+        }
     }
-    /* 解引用 */
-    *pPos = NOT_FIND;
-    
-    return NOT_FIND;
+
+    /* 从小桶到大桶合并: 大桶里的结点更靠前, 放在左边 */
+    LinkNode *result = NULL;
+    LinkNode *tail = NULL;
+    for (int idx = 0; idx <= maxBin; idx++)
+    {
+        if (bins[idx] == NULL)
+        {
+            continue;
+        }
+        if (result == NULL)
+        {
+            result = bins[idx];
+            continue;
+        }
+        /* 最后一次合并时顺便找到尾结点 */
+        result = mergeLinkNodeChain(bins[idx], result, compareFunc, idx == maxBin ? &tail : NULL);
+    }
+
+    /* 只有一个桶时没有经过合并, 单独找尾结点 */
+    if (tail == NULL)
+    {
+        tail = result;
+        while (tail->next != NULL)
+        {
+            tail = tail->next;
+        }
+    }
+
+    pList->head->next = result;
+    pList->tail = tail;
+    return ON_SUCCESS;
 }
 
-/* 链表删除指定的数据 */
-int LinkListDelAppointData(LinkList * pList, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+/* 多路归并的堆比较: 值相等时按链表下标比较, 保证稳定 */
+static int mergeHeapLess(LinkNode **heapNodes, int *heapIdx, int idx1, int idx2, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
 {
-    int ret = 0;
-    /* 元素在链表中的位置 */
-    int pos = 0;
+    int cmp = compareFunc(heapNodes[idx1]->data, heapNodes[idx2]->data);
+    if (cmp != 0)
+    {
+        return cmp < 0;
+    }
+    return heapIdx[idx1] < heapIdx[idx2];
+}
 
-    /* 链表的长度 */
-    int size = 0;
+/* 多路归并的堆下沉 */
+static void mergeHeapSiftDown(LinkNode **heapNodes, int *heapIdx, int heapSize, int pos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+{
+    while (1)
+    {
+        int minPos = pos;
+        int left = 2 * pos + 1;
+        int right = left + 1;
+        if (left < heapSize && mergeHeapLess(heapNodes, heapIdx, left, minPos, compareFunc))
+        {
+            minPos = left;
+        }
+        if (right < heapSize && mergeHeapLess(heapNodes, heapIdx, right, minPos, compareFunc))
+        {
+            minPos = right;
+        }
+        if (minPos == pos)
+        {
+            return;
+        }
 
-    /* 根据指定的元素得到在链表中所在的位置 */
-    while (LinkListAccordAppointValGetPos(pList, val, &pos, compareFunc) != NOT_FIND)
+        LinkNode *tmpNode = heapNodes[pos];
+        heapNodes[pos] = heapNodes[minPos];
+        heapNodes[minPos] = tmpNode;
+        int tmpIdx = heapIdx[pos];
+        heapIdx[pos] = heapIdx[minPos];
+        heapIdx[minPos] = tmpIdx;
+        pos = minPos;
+    }
+}
+
+/* 多路归并: 把 num 个已排好序的链表合并后追加到 pDst 尾部 O(nlogk), 源链表不变. 相等的元素按链表的先后顺序排列 */
+int LinkListMergeSorted(LinkList * pDst, LinkList **lists, int num, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+{
+    if (pDst == NULL || lists == NULL || compareFunc == NULL)
     {
-        LinkListDelAppointPos(pList, pos);
+        return NULL_PTR;
     }
+
+    if (num <= 0)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 目标链表不能同时是源链表: 边追加边读取会读到新追加的结点 */
+    for (int idx = 0; idx < num; idx++)
+    {
+        if (lists[idx] == pDst)
+        {
+            return INVALID_ACCESS;
+        }
+    }
+
+    /* 小顶堆: 存放每个链表当前的结点和链表下标 */
+    LinkNode **heapNodes = (LinkNode **)malloc(sizeof(LinkNode *) * num);
+    int *heapIdx = (int *)malloc(sizeof(int) * num);
+    if (heapNodes == NULL || heapIdx == NULL)
+    {
+        free(heapNodes);
+        free(heapIdx);
+        return MALLOC_ERROR;
+    }
+
+    int heapSize = 0;
+    for (int idx = 0; idx < num; idx++)
+    {
+        if (lists[idx] != NULL && lists[idx]->head->next != NULL)
+        {
+            heapNodes[heapSize] = lists[idx]->head->next;
+            heapIdx[heapSize] = idx;
+            heapSize++;
+        }
+    }
+    for (int pos = heapSize / 2 - 1; pos >= 0; pos--)
+    {
+        mergeHeapSiftDown(heapNodes, heapIdx, heapSize, pos, compareFunc);
+    }
+
+    int ret = ON_SUCCESS;
+    while (heapSize > 0)
+    {
+        LinkNode *minNode = heapNodes[0];
+        ret = LinkListPushBack(pDst, minNode->data);
+        if (ret != ON_SUCCESS)
+        {
+            break;
+        }
+
+        if (minNode->next != NULL)
+        {
+            heapNodes[0] = minNode->next;
+        }
+        else
+        {
+            /* 这个链表合并完了: 用堆尾替换堆顶 */
+            heapSize--;
+            heapNodes[0] = heapNodes[heapSize];
+            heapIdx[0] = heapIdx[heapSize];
+        }
+        mergeHeapSiftDown(heapNodes, heapIdx, heapSize, 0, compareFunc);
+    }
+
+    free(heapNodes);
+    free(heapIdx);
     return ret;
 }
 
@@ -279,12 +734,34 @@ int LinkListGetLength(LinkList * pList, int *pSize)
 int LinkListDestroy(LinkList * pList)
 {
     int ret = 0;
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+#if 0
     /* 我们使用头删释放链表 */
     int size = 0;
     while (LinkListGetLength(pList, &size))
     {
         LinkListHeadDel(pList);
     }
+#else
+    if (pList->ownPool)
+    {
+        /* 自己的结点池: 所有结点随结点池一次释放 */
+        LinkNodePoolDestroy(pList->pool);
+    }
+    else if (pList->len > 0)
+    {
+        /* 共享的结点池: 整条链直接挂到空闲链表上 O(1). tail 必须是真正的最后一个结点 (调试版本检查) */
+        assert(pList->tail->next == NULL);
+        pList->tail->next = pList->pool->freeList;
+        pList->pool->freeList = pList->head->next;
+    }
+    pList->pool = NULL;
+    pList->len = 0;
+#endif
 
     if (pList->head != NULL)
     {
@@ -337,4 +814,177 @@ int LinkListForeach(LinkList * pList, int (*printFunc)(ELEMENTTYPE))
 #endif
     return ret;
 }
-#endif
\ No newline at end of file
+#endif
+
+/* 游标初始化: 指向链表的第一个元素 */
+int LinkListCursorInit(LinkList * pList, LinkListCursor *pCursor)
+{
+    if (pList == NULL || pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    pCursor->list = pList;
+    pCursor->prev = pList->head;
+    pCursor->cur = pList->head->next;
+    return ON_SUCCESS;
+}
+
+/* 游标是否已经走到末尾 */
+int LinkListCursorIsEnd(LinkListCursor *pCursor)
+{
+    if (pCursor == NULL)
+    {
+        return 1;
+    }
+    return pCursor->cur == NULL ? 1 : 0;
+}
+
+/* 游标后移一个结点 */
+int LinkListCursorNext(LinkListCursor *pCursor)
+{
+    if (pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pCursor->cur == NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    pCursor->prev = pCursor->cur;
+    pCursor->cur = pCursor->cur->next;
+    return ON_SUCCESS;
+}
+
+/* 查看游标处的元素 */
+int LinkListCursorPeek(LinkListCursor *pCursor, ELEMENTTYPE *pVal)
+{
+    if (pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pCursor->cur == NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pCursor->cur->data;
+    }
+    return ON_SUCCESS;
+}
+
+/* 修改游标处的元素 */
+int LinkListCursorModify(LinkListCursor *pCursor, ELEMENTTYPE val)
+{
+    if (pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pCursor->cur == NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    pCursor->cur->data = val;
+    return ON_SUCCESS;
+}
+
+/* 在游标处的结点之后插入 (游标在末尾时插到链表尾部), 游标不动 */
+int LinkListCursorInsertAfter(LinkListCursor *pCursor, ELEMENTTYPE val)
+{
+    if (pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    LinkList *pList = pCursor->list;
+    /* 游标在末尾: 插在最后一个结点之后 */
+    LinkNode *travelNode = pCursor->cur != NULL ? pCursor->cur : pCursor->prev;
+
+    LinkNode *newNode = allocLinkNode(pList->pool);
+    if (newNode == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    newNode->data = val;
+    newNode->next = travelNode->next;
+    travelNode->next = newNode;
+
+    /* 插在尾结点之后: 更新尾指针 */
+    if (travelNode == pList->tail)
+    {
+        pList->tail = newNode;
+    }
+    /* 游标在末尾时, 新结点就是游标之前的结点 */
+    if (pCursor->cur == NULL)
+    {
+        pCursor->prev = newNode;
+    }
+
+    (pList->len)++;
+    return ON_SUCCESS;
+}
+
+/* 在游标处的结点之前插入, 游标仍然指向原来的结点 */
+int LinkListCursorInsertBefore(LinkListCursor *pCursor, ELEMENTTYPE val)
+{
+    if (pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    LinkList *pList = pCursor->list;
+    LinkNode *newNode = allocLinkNode(pList->pool);
+    if (newNode == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    newNode->data = val;
+    newNode->next = pCursor->cur;
+    pCursor->prev->next = newNode;
+
+    /* 游标在末尾: 新结点成为尾结点 */
+    if (pCursor->cur == NULL)
+    {
+        pList->tail = newNode;
+    }
+    pCursor->prev = newNode;
+
+    (pList->len)++;
+    return ON_SUCCESS;
+}
+
+/* 删除游标处的结点, 游标移到下一个结点 */
+int LinkListCursorEraseAt(LinkListCursor *pCursor)
+{
+    if (pCursor == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pCursor->cur == NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    LinkList *pList = pCursor->list;
+    LinkNode *needDelNode = pCursor->cur;
+    pCursor->prev->next = needDelNode->next;
+    pCursor->cur = needDelNode->next;
+
+    /* 删除的是尾结点: 尾指针前移 */
+    if (needDelNode == pList->tail)
+    {
+        pList->tail = pCursor->prev;
+    }
+
+    freeLinkNode(pList->pool, needDelNode);
+    (pList->len)--;
+    return ON_SUCCESS;
+}
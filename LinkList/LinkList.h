@@ -12,6 +12,29 @@ typedef struct LinkNode
     struct LinkNode *next;   /* 指针的类型为什么是结点 */
 } LinkNode;
 
+/* 结点池的默认块大小 (每块的结点个数) */
+#define LINK_NODE_POOL_DEFAULT_BLOCK_SIZE   1024
+
+/* 结点池的内存块 */
+typedef struct LinkNodeBlock
+{
+    struct LinkNodeBlock *next;
+    LinkNode nodes[];
+} LinkNodeBlock;
+
+/* 结点池: 从大块内存中切分结点, 删除的结点放到空闲链表里复用 */
+typedef struct LinkNodePool
+{
+    /* 已申请的内存块 */
+    LinkNodeBlock *blocks;
+    /* 空闲结点链表 (用结点的 next 串起来) */
+    LinkNode *freeList;
+    /* 当前块中还没切分的结点 */
+    int blockUsed;
+    /* 每块的结点个数 */
+    int blockSize;
+} LinkNodePool;
+
 /* 链表 */
 typedef struct LinkList
 {
@@ -20,24 +43,59 @@ typedef struct LinkList
     LinkNode * tail;        /* 为什么尾指针不需要分配空间??? */
     /* 链表的长度 */
     int len;
+    /* 结点池 */
+    LinkNodePool *pool;
+    /* 结点池是否是链表自己的 (自己的结点池在销毁链表时一起释放) */
+    int ownPool;
 } LinkList;
 
+/* 链表游标: 停在 cur 结点上, 同时记住前一个结点, 在游标处插入/删除都是 O(1) */
+typedef struct LinkListCursor
+{
+    LinkList *list;
+    /* 前一个结点 (cur 是第一个结点时为虚拟头结点) */
+    LinkNode *prev;
+    /* 当前结点 (NULL表示已经走到链表末尾) */
+    LinkNode *cur;
+} LinkListCursor;
+
 /* 链表初始化 */
 int LinkListInit(LinkList **pList);
 
+/* 链表初始化: 使用共享的结点池 (结点池要在所有使用它的链表销毁之后再销毁) */
+int LinkListInitWithPool(LinkList **pList, LinkNodePool *pool);
+
+/* 结点池初始化 (blockSize <= 0 时使用默认大小) */
+int LinkNodePoolInit(LinkNodePool **pPool, int blockSize);
+
+/* 结点池销毁 */
+int LinkNodePoolDestroy(LinkNodePool *pPool);
+
 /* 链表头插 */
 int LinkListHeadInsert(LinkList * pList, ELEMENTTYPE val);
 
-/* 链表尾插 */
+/* 链表尾插 O(1) */
 int LinkListTailInsert(LinkList * pList, ELEMENTTYPE val);
 
+/* 队尾入队 O(1) */
+int LinkListPushBack(LinkList * pList, ELEMENTTYPE val);
+
+/* 队头出队 O(1): 取出第一个元素 */
+int LinkListPopFront(LinkList * pList, ELEMENTTYPE *pVal);
+
+/* 获取链表 头位置值 O(1) */
+int LinkListGetHeadVal(LinkList * pList, ELEMENTTYPE *pVal);
+
+/* 获取链表 尾位置值 O(1) */
+int LinkListGetTailVal(LinkList * pList, ELEMENTTYPE *pVal);
+
 /* 链表指定位置插入 */
 int LinkListAppointPosInsert(LinkList * pList, int pos, ELEMENTTYPE val);
 
-/* 链表头删 */
+/* 链表头删 O(1) */
 int LinkListHeadDel(LinkList * pList);
 
-/* 链表尾删 */
+/* 链表尾删 O(n): 单链表需要从头找到尾结点的前一个结点 */
 int LinkListTailDel(LinkList * pList);
 
 /* 链表指定位置删 */
@@ -46,6 +104,15 @@ int LinkListDelAppointPos(LinkList * pList, int pos);
 /* 链表删除指定的数据 */
 int LinkListDelAppointData(LinkList * pList, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
 
+/* 链表删除满足条件的结点 (一次遍历). destroyFunc 不为NULL时用来释放被删除的数据 */
+int LinkListRemoveIf(LinkList * pList, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum);
+
+/* 链表排序: 原地, 稳定的自底向上归并排序 O(nlogn). compareFunc 返回 <0, 0, >0 */
+int LinkListSort(LinkList * pList, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+
+/* 多路归并: 把 num 个已排好序的链表合并后追加到 pDst 尾部 O(nlogk), 源链表不变. 相等的元素按链表的先后顺序排列 */
+int LinkListMergeSorted(LinkList * pDst, LinkList **lists, int num, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+
 /* 获取链表的长度 */
 int LinkListGetLength(LinkList * pList, int *pSize);
 
@@ -55,4 +122,28 @@ int LinkListDestroy(LinkList * pList);
 /* 链表遍历接口 */
 int LinkListForeach(LinkList * pList, int (*printFunc)(ELEMENTTYPE));
 
+/* 游标初始化: 指向链表的第一个元素 */
+int LinkListCursorInit(LinkList * pList, LinkListCursor *pCursor);
+
+/* 游标是否已经走到末尾 */
+int LinkListCursorIsEnd(LinkListCursor *pCursor);
+
+/* 游标后移一个结点 */
+int LinkListCursorNext(LinkListCursor *pCursor);
+
+/* 查看游标处的元素 */
+int LinkListCursorPeek(LinkListCursor *pCursor, ELEMENTTYPE *pVal);
+
+/* 修改游标处的元素 */
+int LinkListCursorModify(LinkListCursor *pCursor, ELEMENTTYPE val);
+
+/* 在游标处的结点之后插入 (游标在末尾时插到链表尾部), 游标不动 */
+int LinkListCursorInsertAfter(LinkListCursor *pCursor, ELEMENTTYPE val);
+
+/* 在游标处的结点之前插入, 游标仍然指向原来的结点 */
+int LinkListCursorInsertBefore(LinkListCursor *pCursor, ELEMENTTYPE val);
+
+/* 删除游标处的结点, 游标移到下一个结点 */
+int LinkListCursorEraseAt(LinkListCursor *pCursor);
+
 #endif
\ No newline at end of file
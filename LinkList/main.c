@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include "LinkList.h"
+#include "unrolledLinkList.h"
 #include <string.h>
+#include <time.h>
 
 #define BUFFER_SIZE    6
 
@@ -32,6 +34,153 @@ int compareBasicFunc(void *arg1, void *arg2)
     return data1 - data2;
 }
 
+/* 置1: 运行随机混合操作的回归测试 */
+#define RUN_MIXED_OP_TEST   0
+
+#if RUN_MIXED_OP_TEST
+/* 回归/性能测试: 随机混合操作, 和循环数组实现的双端队列逐个比对 */
+#define MIXED_OP_NUM        10000000
+#define MIXED_MAX_LEN       1024
+#define MODEL_CAPACITY      (MIXED_MAX_LEN * 2)
+
+static int linkListMixedOpTest(void)
+{
+    LinkList *list = NULL;
+    LinkListInit(&list);
+
+    /* 参照模型: 循环数组 */
+    long model[MODEL_CAPACITY];
+    int front = 0;
+    int len = 0;
+
+    unsigned int seed = 12345;
+    int errors = 0;
+    ELEMENTTYPE val = NULL;
+    clock_t begin = clock();
+    for (long idx = 1; idx <= MIXED_OP_NUM; idx++)
+    {
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 16) % 100;
+        if (len >= MIXED_MAX_LEN)
+        {
+            /* 控制链表长度 */
+            op = 99;
+        }
+
+        if (op < 45)
+        {
+            /* 尾插 */
+            LinkListPushBack(list, (ELEMENTTYPE)idx);
+            model[(front + len) % MODEL_CAPACITY] = idx;
+            len++;
+        }
+        else if (op < 55)
+        {
+            /* 头插 */
+            LinkListHeadInsert(list, (ELEMENTTYPE)idx);
+            front = (front + MODEL_CAPACITY - 1) % MODEL_CAPACITY;
+            model[front] = idx;
+            len++;
+        }
+        else if (op < 56)
+        {
+            /* 尾删 O(n) */
+            if (LinkListTailDel(list) == 0)
+            {
+                len--;
+            }
+        }
+        else if (op < 60)
+        {
+            /* 查看尾部 */
+            if (len > 0 && (LinkListGetTailVal(list, &val) != 0 || (long)val != model[(front + len - 1) % MODEL_CAPACITY]))
+            {
+                errors++;
+            }
+        }
+        else
+        {
+            /* 头删 */
+            if (LinkListPopFront(list, &val) == 0)
+            {
+                if (len == 0 || (long)val != model[front])
+                {
+                    errors++;
+                }
+                front = (front + 1) % MODEL_CAPACITY;
+                len--;
+            }
+            else if (len != 0)
+            {
+                errors++;
+            }
+        }
+
+        if (LinkListGetLength(list, NULL) != len)
+        {
+            errors++;
+        }
+    }
+    clock_t end = clock();
+
+    printf("mixed ops:%d\terrors:%d\tcost:%.3fs\n", MIXED_OP_NUM, errors, (double)(end - begin) / CLOCKS_PER_SEC);
+    LinkListDestroy(list);
+    return errors;
+}
+#endif
+
+/* 置1: 运行长链表遍历的性能测试 */
+#define RUN_SCAN_BENCH      0
+
+#if RUN_SCAN_BENCH
+/* 性能测试: 长链表的遍历, 普通链表和展开链表对比 */
+#define SCAN_ELEMENT_NUM    1000000
+#define SCAN_ROUNDS         20
+
+static long g_scanSum = 0;
+
+static int scanSumFunc(ELEMENTTYPE val)
+{
+    g_scanSum += (long)val;
+    return 0;
+}
+
+static int linkListScanBench(void)
+{
+    LinkList *list = NULL;
+    unrolledLinkList *unrolledList = NULL;
+    LinkListInit(&list);
+    unrolledLinkListInit(&unrolledList);
+    for (long idx = 0; idx < SCAN_ELEMENT_NUM; idx++)
+    {
+        LinkListTailInsert(list, (ELEMENTTYPE)idx);
+        unrolledLinkListTailInsert(unrolledList, (ELEMENTTYPE)idx);
+    }
+
+    g_scanSum = 0;
+    clock_t begin = clock();
+    for (int round = 0; round < SCAN_ROUNDS; round++)
+    {
+        LinkListForeach(list, scanSumFunc);
+    }
+    clock_t end = clock();
+    printf("LinkList scan:\tsum:%ld\tcost:%.3fs\n", g_scanSum, (double)(end - begin) / CLOCKS_PER_SEC);
+
+    g_scanSum = 0;
+    begin = clock();
+    for (int round = 0; round < SCAN_ROUNDS; round++)
+    {
+        unrolledLinkListForeach(unrolledList, scanSumFunc);
+    }
+    end = clock();
+    printf("unrolled scan:\tsum:%ld\tcost:%.3fs\n", g_scanSum, (double)(end - begin) / CLOCKS_PER_SEC);
+
+    LinkListDestroy(list);
+    unrolledLinkListDestroy(unrolledList);
+    return 0;
+}
+#endif
+
 int main()
 {
 #if 0
@@ -51,7 +200,13 @@ int main()
     /* 初始化链表 */
     LinkListInit(&list);
 
-#if 1
+#if RUN_MIXED_OP_TEST
+    LinkListDestroy(list);
+    linkListMixedOpTest();
+#elif RUN_SCAN_BENCH
+    LinkListDestroy(list);
+    linkListScanBench();
+#elif 1
     int buffer[BUFFER_SIZE] = {1, 2, 3, 4, 5, 6};
     /* 插入数据 */
     for (int idx = 0; idx < BUFFER_SIZE; idx++)
@@ -104,6 +259,11 @@ int main()
     LinkListForeach(list, printBasicData);
     printf("\n");
 
+    printf("===================\n");
+    LinkListSort(list, compareBasicFunc);
+    LinkListForeach(list, printBasicData);
+    printf("\n");
+
     /* 销毁链表 */
     LinkListDestroy(list);
 #else
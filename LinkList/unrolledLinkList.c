@@ -0,0 +1,519 @@
+#include "unrolledLinkList.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    NOT_FIND = -1,
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 结点中的元素少于这个数时, 尝试和后一个结点合并 */
+#define UNROLLED_NODE_MERGE_THRESHOLD   (UNROLLED_NODE_CAPACITY / 4)
+
+/* 静态前置声明 */
+static unrolledLinkNode * allocUnrolledNode(void);
+static unrolledLinkNode * unrolledLinkListLocate(unrolledLinkList *pList, int pos, unrolledLinkNode **pPrev, int *pOffset);
+static void unrolledLinkListRemoveAt(unrolledLinkList *pList, unrolledLinkNode *prev, unrolledLinkNode *node, int offset);
+static int unrolledLinkListCompareEqual(ELEMENTTYPE data, void *arg);
+
+/* 按值删除时传给 unrolledLinkListRemoveIf 的参数 */
+typedef struct unrolledLinkListCompareCtx
+{
+    ELEMENTTYPE val;
+    int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE);
+} unrolledLinkListCompareCtx;
+
+/* 申请一个空结点 */
+static unrolledLinkNode * allocUnrolledNode(void)
+{
+    unrolledLinkNode *node = (unrolledLinkNode *)malloc(sizeof(unrolledLinkNode));
+    if (node == NULL)
+    {
+        return NULL;
+    }
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+/* 找到 pos 位置所在的结点和结点内的下标 (0 <= pos < len). pPrev 不为NULL时同时返回前一个结点 */
+static unrolledLinkNode * unrolledLinkListLocate(unrolledLinkList *pList, int pos, unrolledLinkNode **pPrev, int *pOffset)
+{
+    /* 不需要前一个结点时, 尾结点里的位置直接定位 */
+    if (pPrev == NULL && pos >= pList->len - pList->tail->count)
+    {
+        *pOffset = pos - (pList->len - pList->tail->count);
+        return pList->tail;
+    }
+
+    unrolledLinkNode *prev = NULL;
+    unrolledLinkNode *travelNode = pList->head;
+    /* 按结点跳过, 每次跳过 count 个元素 */
+    while (pos >= travelNode->count)
+    {
+        pos -= travelNode->count;
+        prev = travelNode;
+        travelNode = travelNode->next;
+    }
+
+    if (pPrev != NULL)
+    {
+        *pPrev = prev;
+    }
+    *pOffset = pos;
+    return travelNode;
+}
+
+/* 链表初始化 */
+int unrolledLinkListInit(unrolledLinkList **pList)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unrolledLinkList *list = (unrolledLinkList *)malloc(sizeof(unrolledLinkList));
+    if (list == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(list, 0, sizeof(unrolledLinkList));
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->len = 0;
+
+    *pList = list;
+    return ON_SUCCESS;
+}
+
+/* 链表头插 */
+int unrolledLinkListHeadInsert(unrolledLinkList *pList, ELEMENTTYPE val)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 头结点满了: 在前面挂一个新结点, 不拆分头结点 */
+    if (pList->head != NULL && pList->head->count == UNROLLED_NODE_CAPACITY)
+    {
+        unrolledLinkNode *newNode = allocUnrolledNode();
+        if (newNode == NULL)
+        {
+            return MALLOC_ERROR;
+        }
+        newNode->data[0] = val;
+        newNode->count = 1;
+        newNode->next = pList->head;
+        pList->head = newNode;
+        (pList->len)++;
+        return ON_SUCCESS;
+    }
+
+    return unrolledLinkListAppointPosInsert(pList, 0, val);
+}
+
+/* 链表尾插 O(1) */
+int unrolledLinkListTailInsert(unrolledLinkList *pList, ELEMENTTYPE val)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 尾结点满了 (或者链表为空): 挂一个新结点, 已满的结点保持满的, 空间利用率高 */
+    if (pList->tail == NULL || pList->tail->count == UNROLLED_NODE_CAPACITY)
+    {
+        unrolledLinkNode *newNode = allocUnrolledNode();
+        if (newNode == NULL)
+        {
+            return MALLOC_ERROR;
+        }
+        if (pList->tail == NULL)
+        {
+            pList->head = newNode;
+        }
+        else
+        {
+            pList->tail->next = newNode;
+        }
+        pList->tail = newNode;
+    }
+
+    pList->tail->data[pList->tail->count++] = val;
+    (pList->len)++;
+    return ON_SUCCESS;
+}
+
+/* 链表指定位置插入 */
+int unrolledLinkListAppointPosInsert(unrolledLinkList *pList, int pos, ELEMENTTYPE val)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pos < 0 || pos > pList->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pos == pList->len)
+    {
+        return unrolledLinkListTailInsert(pList, val);
+    }
+
+    int offset = 0;
+    unrolledLinkNode *node = unrolledLinkListLocate(pList, pos, NULL, &offset);
+
+    /* 结点满了: 后一半元素搬到新结点 */
+    if (node->count == UNROLLED_NODE_CAPACITY)
+    {
+        unrolledLinkNode *newNode = allocUnrolledNode();
+        if (newNode == NULL)
+        {
+            return MALLOC_ERROR;
+        }
+        int half = UNROLLED_NODE_CAPACITY / 2;
+        memcpy(newNode->data, node->data + half, sizeof(ELEMENTTYPE) * (UNROLLED_NODE_CAPACITY - half));
+        newNode->count = UNROLLED_NODE_CAPACITY - half;
+        node->count = half;
+
+        newNode->next = node->next;
+        node->next = newNode;
+        if (pList->tail == node)
+        {
+            pList->tail = newNode;
+        }
+
+        if (offset > half)
+        {
+            node = newNode;
+            offset -= half;
+        }
+    }
+
+    /* 结点内后面的元素后移 */
+    memmove(node->data + offset + 1, node->data + offset, sizeof(ELEMENTTYPE) * (node->count - offset));
+    node->data[offset] = val;
+    (node->count)++;
+    (pList->len)++;
+    return ON_SUCCESS;
+}
+
+/* 获取链表 头位置值 O(1) */
+int unrolledLinkListGetHeadVal(unrolledLinkList *pList, ELEMENTTYPE *pVal)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pList->head->data[0];
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取链表 尾位置值 O(1) */
+int unrolledLinkListGetTailVal(unrolledLinkList *pList, ELEMENTTYPE *pVal)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pList->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pList->tail->data[pList->tail->count - 1];
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取链表 指定位置值 */
+int unrolledLinkListGetAppointPosVal(unrolledLinkList *pList, int pos, ELEMENTTYPE *pVal)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pos < 0 || pos >= pList->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    int offset = 0;
+    unrolledLinkNode *node = unrolledLinkListLocate(pList, pos, NULL, &offset);
+    if (pVal != NULL)
+    {
+        *pVal = node->data[offset];
+    }
+    return ON_SUCCESS;
+}
+
+/* 删除结点中 offset 处的元素: 结点空了就释放, 元素太少时和后一个结点合并 */
+static void unrolledLinkListRemoveAt(unrolledLinkList *pList, unrolledLinkNode *prev, unrolledLinkNode *node, int offset)
+{
+    memmove(node->data + offset, node->data + offset + 1, sizeof(ELEMENTTYPE) * (node->count - offset - 1));
+    (node->count)--;
+    (pList->len)--;
+
+    if (node->count == 0)
+    {
+        if (prev == NULL)
+        {
+            pList->head = node->next;
+        }
+        else
+        {
+            prev->next = node->next;
+        }
+        if (pList->tail == node)
+        {
+            pList->tail = prev;
+        }
+        free(node);
+        return;
+    }
+
+    unrolledLinkNode *nextNode = node->next;
+    if (node->count < UNROLLED_NODE_MERGE_THRESHOLD && nextNode != NULL && node->count + nextNode->count <= UNROLLED_NODE_CAPACITY)
+    {
+        memcpy(node->data + node->count, nextNode->data, sizeof(ELEMENTTYPE) * nextNode->count);
+        node->count += nextNode->count;
+        node->next = nextNode->next;
+        if (pList->tail == nextNode)
+        {
+            pList->tail = node;
+        }
+        free(nextNode);
+    }
+}
+
+/* 链表头删 */
+int unrolledLinkListHeadDel(unrolledLinkList *pList)
+{
+    return unrolledLinkListDelAppointPos(pList, 0);
+}
+
+/* 链表尾删 */
+int unrolledLinkListTailDel(unrolledLinkList *pList)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 尾结点里还剩多个元素时不需要找前一个结点 */
+    if (pList->tail != NULL && pList->tail->count > 1)
+    {
+        (pList->tail->count)--;
+        (pList->len)--;
+        return ON_SUCCESS;
+    }
+
+    return unrolledLinkListDelAppointPos(pList, pList->len - 1);
+}
+
+/* 链表指定位置删 */
+int unrolledLinkListDelAppointPos(unrolledLinkList *pList, int pos)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pos < 0 || pos >= pList->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    unrolledLinkNode *prev = NULL;
+    int offset = 0;
+    unrolledLinkNode *node = unrolledLinkListLocate(pList, pos, &prev, &offset);
+    unrolledLinkListRemoveAt(pList, prev, node, offset);
+    return ON_SUCCESS;
+}
+
+/* 判断元素是否等于要删除的值 */
+static int unrolledLinkListCompareEqual(ELEMENTTYPE data, void *arg)
+{
+    unrolledLinkListCompareCtx *ctx = (unrolledLinkListCompareCtx *)arg;
+    return ctx->compareFunc(ctx->val, data) == 0;
+}
+
+/* 链表删除指定的数据 */
+int unrolledLinkListDelAppointData(unrolledLinkList *pList, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+{
+    if (compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unrolledLinkListCompareCtx ctx = {val, compareFunc};
+    return unrolledLinkListRemoveIf(pList, unrolledLinkListCompareEqual, &ctx, NULL, NULL);
+}
+
+/* 链表删除满足条件的元素 (一次遍历). destroyFunc 不为NULL时用来释放被删除的数据 */
+int unrolledLinkListRemoveIf(unrolledLinkList *pList, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum)
+{
+    if (pList == NULL || predicate == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int removeNum = 0;
+    unrolledLinkNode *prev = NULL;
+    unrolledLinkNode *travelNode = pList->head;
+    while (travelNode != NULL)
+    {
+        unrolledLinkNode *nextNode = travelNode->next;
+
+        /* 结点内压缩: 保留的元素依次前移 */
+        int keep = 0;
+        for (int idx = 0; idx < travelNode->count; idx++)
+        {
+            ELEMENTTYPE val = travelNode->data[idx];
+            if (predicate(val, ctx))
+            {
+                if (destroyFunc != NULL)
+                {
+                    destroyFunc(val);
+                }
+                removeNum++;
+            }
+            else
+            {
+                travelNode->data[keep++] = val;
+            }
+        }
+        travelNode->count = keep;
+
+        if (prev != NULL && prev->count + travelNode->count <= UNROLLED_NODE_CAPACITY)
+        {
+            /* 能放进前一个结点: 合并后释放当前结点 (空结点也走这里) */
+            memcpy(prev->data + prev->count, travelNode->data, sizeof(ELEMENTTYPE) * travelNode->count);
+            prev->count += travelNode->count;
+            prev->next = nextNode;
+            free(travelNode);
+        }
+        else if (prev == NULL && travelNode->count == 0)
+        {
+            /* 第一个结点空了 */
+            pList->head = nextNode;
+            free(travelNode);
+        }
+        else
+        {
+            prev = travelNode;
+        }
+        travelNode = nextNode;
+    }
+    pList->tail = prev;
+    pList->len -= removeNum;
+
+    if (pRemoveNum != NULL)
+    {
+        *pRemoveNum = removeNum;
+    }
+    return ON_SUCCESS;
+}
+
+/* 查找第一个等于 val 的位置, 找不到 *pPos 为-1 */
+int unrolledLinkListFind(unrolledLinkList *pList, ELEMENTTYPE val, int *pPos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE))
+{
+    if (pList == NULL || pPos == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int base = 0;
+    for (unrolledLinkNode *travelNode = pList->head; travelNode != NULL; travelNode = travelNode->next)
+    {
+        for (int idx = 0; idx < travelNode->count; idx++)
+        {
+            if (compareFunc(val, travelNode->data[idx]) == 0)
+            {
+                *pPos = base + idx;
+                return ON_SUCCESS;
+            }
+        }
+        base += travelNode->count;
+    }
+
+    *pPos = NOT_FIND;
+    return NOT_FIND;
+}
+
+/* 获取链表的长度 */
+int unrolledLinkListGetLength(unrolledLinkList *pList, int *pSize)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pSize != NULL)
+    {
+        *pSize = pList->len;
+    }
+    return pList->len;
+}
+
+/* 链表的销毁 */
+int unrolledLinkListDestroy(unrolledLinkList *pList)
+{
+    if (pList == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unrolledLinkNode *travelNode = pList->head;
+    while (travelNode != NULL)
+    {
+        unrolledLinkNode *nextNode = travelNode->next;
+        free(travelNode);
+        travelNode = nextNode;
+    }
+
+    free(pList);
+    return ON_SUCCESS;
+}
+
+/* 链表遍历接口 */
+int unrolledLinkListForeach(unrolledLinkList *pList, int (*printFunc)(ELEMENTTYPE))
+{
+    if (pList == NULL || printFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    for (unrolledLinkNode *travelNode = pList->head; travelNode != NULL; travelNode = travelNode->next)
+    {
+        for (int idx = 0; idx < travelNode->count; idx++)
+        {
+            printFunc(travelNode->data[idx]);
+        }
+    }
+    return ON_SUCCESS;
+}
@@ -0,0 +1,80 @@
+#ifndef __UNROLLED_LINKLIST_H_
+#define __UNROLLED_LINKLIST_H_
+
+#ifndef ELEMENTTYPE
+#define ELEMENTTYPE void*
+#endif
+
+/* 每个结点存放的元素个数 */
+#define UNROLLED_NODE_CAPACITY  32
+
+/* 展开链表的结点: 一个结点连续存放多个元素, 遍历时一次缓存未命中可以读到多个元素 */
+typedef struct unrolledLinkNode
+{
+    /* 指向下一个结点的指针 */
+    struct unrolledLinkNode *next;
+    /* 结点中元素的个数 */
+    int count;
+    ELEMENTTYPE data[UNROLLED_NODE_CAPACITY];
+} unrolledLinkNode;
+
+/* 展开链表 */
+typedef struct unrolledLinkList
+{
+    /* 第一个结点 (空链表时为NULL) */
+    unrolledLinkNode *head;
+    /* 最后一个结点 */
+    unrolledLinkNode *tail;
+    /* 链表的长度 (元素个数) */
+    int len;
+} unrolledLinkList;
+
+/* 链表初始化 */
+int unrolledLinkListInit(unrolledLinkList **pList);
+
+/* 链表头插 */
+int unrolledLinkListHeadInsert(unrolledLinkList *pList, ELEMENTTYPE val);
+
+/* 链表尾插 O(1) */
+int unrolledLinkListTailInsert(unrolledLinkList *pList, ELEMENTTYPE val);
+
+/* 链表指定位置插入 */
+int unrolledLinkListAppointPosInsert(unrolledLinkList *pList, int pos, ELEMENTTYPE val);
+
+/* 获取链表 头位置值 O(1) */
+int unrolledLinkListGetHeadVal(unrolledLinkList *pList, ELEMENTTYPE *pVal);
+
+/* 获取链表 尾位置值 O(1) */
+int unrolledLinkListGetTailVal(unrolledLinkList *pList, ELEMENTTYPE *pVal);
+
+/* 获取链表 指定位置值 */
+int unrolledLinkListGetAppointPosVal(unrolledLinkList *pList, int pos, ELEMENTTYPE *pVal);
+
+/* 链表头删 */
+int unrolledLinkListHeadDel(unrolledLinkList *pList);
+
+/* 链表尾删 */
+int unrolledLinkListTailDel(unrolledLinkList *pList);
+
+/* 链表指定位置删 */
+int unrolledLinkListDelAppointPos(unrolledLinkList *pList, int pos);
+
+/* 链表删除指定的数据 */
+int unrolledLinkListDelAppointData(unrolledLinkList *pList, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+
+/* 链表删除满足条件的元素 (一次遍历). destroyFunc 不为NULL时用来释放被删除的数据 */
+int unrolledLinkListRemoveIf(unrolledLinkList *pList, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum);
+
+/* 查找第一个等于 val 的位置, 找不到 *pPos 为-1 */
+int unrolledLinkListFind(unrolledLinkList *pList, ELEMENTTYPE val, int *pPos, int (*compareFunc)(ELEMENTTYPE, ELEMENTTYPE));
+
+/* 获取链表的长度 */
+int unrolledLinkListGetLength(unrolledLinkList *pList, int *pSize);
+
+/* 链表的销毁 */
+int unrolledLinkListDestroy(unrolledLinkList *pList);
+
+/* 链表遍历接口 */
+int unrolledLinkListForeach(unrolledLinkList *pList, int (*printFunc)(ELEMENTTYPE));
+
+#endif // __UNROLLED_LINKLIST_H_
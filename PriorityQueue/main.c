@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "priorityQueue.h"
+#include "doubleLinkList.h"
+
+#define BUFFER_SIZE 6
+
+/* 置1: 运行优先队列和有序链表的性能对比 */
+#define RUN_PRIORITY_QUEUE_BENCH    0
+
+int compareBasicFunc(void *arg1, void *arg2)
+{
+    int data1 = *(int *)arg1;
+    int data2 = *(int *)arg2;
+    return data1 - data2;
+}
+
+#if RUN_PRIORITY_QUEUE_BENCH
+/* 性能测试: 优先队列和手工维护的有序链表对比 */
+#define BENCH_ELEMENT_NUM   20000
+
+/* 测试用: 元素直接存整数 */
+static int compareLongFunc(ELEMENTTYPE val1, ELEMENTTYPE val2)
+{
+    long data1 = (long)val1;
+    long data2 = (long)val2;
+    return data1 < data2 ? -1 : (data1 > data2 ? 1 : 0);
+}
+
+static double benchSeconds(clock_t begin)
+{
+    return (double)(clock() - begin) / CLOCKS_PER_SEC;
+}
+
+/* 有序链表: 从头找到第一个更大的元素, 插在它前面 */
+static double sortedListBench(long *keys, int num, long *pCheckSum)
+{
+    DoubleLinkList *list = NULL;
+    DoubleLinkListInit(&list);
+    /* 新结点先放到 staging 里, 再直接搬到找到的结点后面, 不用按位置再走一遍 */
+    DoubleLinkList *staging = NULL;
+    DoubleLinkListInit(&staging);
+
+    clock_t begin = clock();
+    for (int idx = 0; idx < num; idx++)
+    {
+        DoubleLinkNode *prevNode = list->head;
+        while (prevNode->next != NULL && compareLongFunc(prevNode->next->data, (ELEMENTTYPE)keys[idx]) <= 0)
+        {
+            prevNode = prevNode->next;
+        }
+        DoubleLinkListTailInsert(staging, (ELEMENTTYPE)keys[idx]);
+        DoubleLinkListSpliceNodes(list, prevNode, staging, staging->tail, staging->tail, 1);
+    }
+
+    long checkSum = 0;
+    ELEMENTTYPE val = NULL;
+    for (int idx = 0; idx < num; idx++)
+    {
+        DoubleLinkListGetHeadVal(list, &val);
+        DoubleLinkListHeadDel(list);
+        /* 按出队顺序加权, 顺序不对结果就不同 */
+        checkSum += (long)val * idx;
+    }
+    double cost = benchSeconds(begin);
+
+    DoubleLinkListDestroy(staging);
+    DoubleLinkListDestroy(list);
+    *pCheckSum = checkSum;
+    return cost;
+}
+
+/* d 叉堆: 逐个入队后全部出队 */
+static double heapBench(long *keys, int num, int arity, long *pCheckSum)
+{
+    priorityQueue *queue = NULL;
+    priorityQueueInit(&queue, arity, compareLongFunc);
+
+    clock_t begin = clock();
+    for (int idx = 0; idx < num; idx++)
+    {
+        priorityQueuePush(queue, (ELEMENTTYPE)keys[idx], NULL);
+    }
+
+    long checkSum = 0;
+    ELEMENTTYPE val = NULL;
+    for (int idx = 0; idx < num; idx++)
+    {
+        priorityQueuePop(queue, &val);
+        checkSum += (long)val * idx;
+    }
+    double cost = benchSeconds(begin);
+
+    priorityQueueDestroy(queue);
+    *pCheckSum = checkSum;
+    return cost;
+}
+
+/* 从动态数组 O(n) 建堆后全部出队 */
+static double heapifyBench(long *keys, int num, int arity, long *pCheckSum)
+{
+    dynamicArray array;
+    dynamicArrayInit(&array, num);
+    for (int idx = 0; idx < num; idx++)
+    {
+        dynamicArrayInsertData(&array, (ELEMENTTYPE)keys[idx]);
+    }
+    priorityQueue *queue = NULL;
+    priorityQueueInit(&queue, arity, compareLongFunc);
+
+    clock_t begin = clock();
+    priorityQueueHeapify(queue, &array, NULL);
+
+    long checkSum = 0;
+    ELEMENTTYPE val = NULL;
+    for (int idx = 0; idx < num; idx++)
+    {
+        priorityQueuePop(queue, &val);
+        checkSum += (long)val * idx;
+    }
+    double cost = benchSeconds(begin);
+
+    priorityQueueDestroy(queue);
+    dynamicArrayDestroy(&array);
+    *pCheckSum = checkSum;
+    return cost;
+}
+#endif
+
+int main()
+{
+#if RUN_PRIORITY_QUEUE_BENCH
+    long *keys = (long *)malloc(sizeof(long) * BENCH_ELEMENT_NUM);
+    srand(12345);
+    for (int idx = 0; idx < BENCH_ELEMENT_NUM; idx++)
+    {
+        keys[idx] = rand();
+    }
+
+    long listSum = 0;
+    long heapSum = 0;
+    double cost = sortedListBench(keys, BENCH_ELEMENT_NUM, &listSum);
+    printf("sorted list:      %.3fs\n", cost);
+    cost = heapBench(keys, BENCH_ELEMENT_NUM, 2, &heapSum);
+    printf("binary heap:      %.3fs\t%s\n", cost, heapSum == listSum ? "ok" : "mismatch");
+    cost = heapBench(keys, BENCH_ELEMENT_NUM, 4, &heapSum);
+    printf("4-ary heap:       %.3fs\t%s\n", cost, heapSum == listSum ? "ok" : "mismatch");
+    cost = heapifyBench(keys, BENCH_ELEMENT_NUM, 4, &heapSum);
+    printf("4-ary heapify:    %.3fs\t%s\n", cost, heapSum == listSum ? "ok" : "mismatch");
+
+    free(keys);
+#else
+    priorityQueue *queue = NULL;
+    priorityQueueInit(&queue, PRIORITY_QUEUE_DEFAULT_ARITY, compareBasicFunc);
+
+    int buffer[BUFFER_SIZE] = {56, 12, 87, 33, 5, 41};
+    int handles[BUFFER_SIZE] = {0};
+    for (int idx = 0; idx < BUFFER_SIZE; idx++)
+    {
+        priorityQueuePush(queue, &buffer[idx], &handles[idx]);
+    }
+
+    int size = 0;
+    priorityQueueGetSize(queue, &size);
+    printf("size:%d\n", size);
+
+    /* 87 的优先级提到最高 */
+    int urgent = 1;
+    priorityQueueDecreaseKey(queue, handles[2], &urgent);
+
+    int *val = NULL;
+    while (!priorityQueueIsEmpty(queue))
+    {
+        priorityQueuePop(queue, (void **)&val);
+        printf("val:%d\n", *val);
+    }
+
+    /* 队列销毁 */
+    priorityQueueDestroy(queue);
+#endif
+
+    return 0;
+}
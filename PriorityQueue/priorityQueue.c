@@ -0,0 +1,382 @@
+#include "priorityQueue.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 静态函数前置声明 */
+static int reservePriorityQueue(priorityQueue *pQueue, int needCapacity);
+static int allocQueueHandle(priorityQueue *pQueue);
+static void freeQueueHandle(priorityQueue *pQueue, int handle);
+static void priorityQueueSiftUp(priorityQueue *pQueue, int pos);
+static void priorityQueueSiftDown(priorityQueue *pQueue, int pos);
+static int priorityQueueHandleValid(priorityQueue *pQueue, int handle);
+
+/* 扩容: 容量翻倍直到放得下 needCapacity 个元素 (句柄个数不会超过容量) */
+static int reservePriorityQueue(priorityQueue *pQueue, int needCapacity)
+{
+    if (needCapacity <= pQueue->capacity)
+    {
+        return ON_SUCCESS;
+    }
+
+    int newCapacity = pQueue->capacity;
+    while (newCapacity < needCapacity)
+    {
+        newCapacity *= 2;
+    }
+
+    priorityQueueEntry *newHeap = (priorityQueueEntry *)realloc(pQueue->heap, sizeof(priorityQueueEntry) * newCapacity);
+    if (newHeap == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    pQueue->heap = newHeap;
+
+    int *newHandlePos = (int *)realloc(pQueue->handlePos, sizeof(int) * newCapacity);
+    if (newHandlePos == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    pQueue->handlePos = newHandlePos;
+
+    int *newFreeHandles = (int *)realloc(pQueue->freeHandles, sizeof(int) * newCapacity);
+    if (newFreeHandles == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    pQueue->freeHandles = newFreeHandles;
+
+    /* 三个数组都扩容成功才更新容量 */
+    pQueue->capacity = newCapacity;
+    return ON_SUCCESS;
+}
+
+/* 分配句柄: 优先复用出队元素的句柄 */
+static int allocQueueHandle(priorityQueue *pQueue)
+{
+    if (pQueue->freeNum > 0)
+    {
+        return pQueue->freeHandles[--(pQueue->freeNum)];
+    }
+    return (pQueue->handleNum)++;
+}
+
+/* 回收句柄 */
+static void freeQueueHandle(priorityQueue *pQueue, int handle)
+{
+    pQueue->handlePos[handle] = -1;
+    pQueue->freeHandles[(pQueue->freeNum)++] = handle;
+}
+
+/* 上浮: 先把元素拿出来留出空位, 父结点依次下移, 最后放回元素 */
+static void priorityQueueSiftUp(priorityQueue *pQueue, int pos)
+{
+    priorityQueueEntry entry = pQueue->heap[pos];
+    while (pos > 0)
+    {
+        int parent = (pos - 1) / pQueue->arity;
+        if (pQueue->compareFunc(entry.data, pQueue->heap[parent].data) >= 0)
+        {
+            break;
+        }
+        pQueue->heap[pos] = pQueue->heap[parent];
+        pQueue->handlePos[pQueue->heap[pos].handle] = pos;
+        pos = parent;
+    }
+    pQueue->heap[pos] = entry;
+    pQueue->handlePos[entry.handle] = pos;
+}
+
+/* 下沉: 每层在 d 个孩子里找优先级最高的, 比元素高就上移 */
+static void priorityQueueSiftDown(priorityQueue *pQueue, int pos)
+{
+    priorityQueueEntry entry = pQueue->heap[pos];
+    while (1)
+    {
+        int firstChild = pos * pQueue->arity + 1;
+        if (firstChild >= pQueue->len)
+        {
+            break;
+        }
+
+        int lastChild = firstChild + pQueue->arity;
+        if (lastChild > pQueue->len)
+        {
+            lastChild = pQueue->len;
+        }
+        int bestChild = firstChild;
+        for (int child = firstChild + 1; child < lastChild; child++)
+        {
+            if (pQueue->compareFunc(pQueue->heap[child].data, pQueue->heap[bestChild].data) < 0)
+            {
+                bestChild = child;
+            }
+        }
+
+        if (pQueue->compareFunc(pQueue->heap[bestChild].data, entry.data) >= 0)
+        {
+            break;
+        }
+        pQueue->heap[pos] = pQueue->heap[bestChild];
+        pQueue->handlePos[pQueue->heap[pos].handle] = pos;
+        pos = bestChild;
+    }
+    pQueue->heap[pos] = entry;
+    pQueue->handlePos[entry.handle] = pos;
+}
+
+/* 句柄是否对应队列中的元素 */
+static int priorityQueueHandleValid(priorityQueue *pQueue, int handle)
+{
+    return handle >= 0 && handle < pQueue->handleNum && pQueue->handlePos[handle] >= 0;
+}
+
+/* 优先队列初始化 (arity < 2 时使用默认叉数) */
+int priorityQueueInit(priorityQueue **pQueue, int arity, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    if (pQueue == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    priorityQueue *queue = (priorityQueue *)malloc(sizeof(priorityQueue));
+    if (queue == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(queue, 0, sizeof(priorityQueue));
+
+    queue->heap = (priorityQueueEntry *)malloc(sizeof(priorityQueueEntry) * PRIORITY_QUEUE_INIT_CAPACITY);
+    queue->handlePos = (int *)malloc(sizeof(int) * PRIORITY_QUEUE_INIT_CAPACITY);
+    queue->freeHandles = (int *)malloc(sizeof(int) * PRIORITY_QUEUE_INIT_CAPACITY);
+    if (queue->heap == NULL || queue->handlePos == NULL || queue->freeHandles == NULL)
+    {
+        free(queue->heap);
+        free(queue->handlePos);
+        free(queue->freeHandles);
+        free(queue);
+        return MALLOC_ERROR;
+    }
+    queue->capacity = PRIORITY_QUEUE_INIT_CAPACITY;
+    queue->arity = arity >= 2 ? arity : PRIORITY_QUEUE_DEFAULT_ARITY;
+    queue->compareFunc = compareFunc;
+
+    *pQueue = queue;
+    return ON_SUCCESS;
+}
+
+/* 入队 O(log_d n), pHandle 不为NULL时返回元素的句柄 */
+int priorityQueuePush(priorityQueue *pQueue, ELEMENTTYPE val, int *pHandle)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int ret = reservePriorityQueue(pQueue, pQueue->len + 1);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+
+    int handle = allocQueueHandle(pQueue);
+    pQueue->heap[pQueue->len].data = val;
+    pQueue->heap[pQueue->len].handle = handle;
+    (pQueue->len)++;
+    priorityQueueSiftUp(pQueue, pQueue->len - 1);
+
+    if (pHandle != NULL)
+    {
+        *pHandle = handle;
+    }
+    return ON_SUCCESS;
+}
+
+/* 批量建堆 O(n): 把动态数组中的元素全部入队, pHandles 不为NULL时依次返回每个元素的句柄 */
+int priorityQueueHeapify(priorityQueue *pQueue, dynamicArray *pArray, int *pHandles)
+{
+    if (pQueue == NULL || pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int num = pArray->len;
+    int ret = reservePriorityQueue(pQueue, pQueue->len + num);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+
+    /* 先全部放到数组末尾 */
+    for (int idx = 0; idx < num; idx++)
+    {
+        int handle = allocQueueHandle(pQueue);
+        pQueue->heap[pQueue->len].data = pArray->data[idx];
+        pQueue->heap[pQueue->len].handle = handle;
+        pQueue->handlePos[handle] = pQueue->len;
+        (pQueue->len)++;
+        if (pHandles != NULL)
+        {
+            pHandles[idx] = handle;
+        }
+    }
+
+    /* 自底向上下沉: 从最后一个非叶子结点开始 */
+    if (pQueue->len > 1)
+    {
+        for (int pos = (pQueue->len - 2) / pQueue->arity; pos >= 0; pos--)
+        {
+            priorityQueueSiftDown(pQueue, pos);
+        }
+    }
+    return ON_SUCCESS;
+}
+
+/* 查看优先级最高的元素 */
+int priorityQueueTop(priorityQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pQueue->heap[0].data;
+    }
+    return ON_SUCCESS;
+}
+
+/* 出队 O(d * log_d n): 取出优先级最高的元素 */
+int priorityQueuePop(priorityQueue *pQueue, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pQueue->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    return priorityQueueRemove(pQueue, pQueue->heap[0].handle, pVal);
+}
+
+/* 提高元素的优先级 (新值不能比原来的优先级低) */
+int priorityQueueDecreaseKey(priorityQueue *pQueue, int handle, ELEMENTTYPE val)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (!priorityQueueHandleValid(pQueue, handle))
+    {
+        return INVALID_ACCESS;
+    }
+
+    int pos = pQueue->handlePos[handle];
+    if (pQueue->compareFunc(val, pQueue->heap[pos].data) > 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    pQueue->heap[pos].data = val;
+    priorityQueueSiftUp(pQueue, pos);
+    return ON_SUCCESS;
+}
+
+/* 删除句柄对应的元素 */
+int priorityQueueRemove(priorityQueue *pQueue, int handle, ELEMENTTYPE *pVal)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (!priorityQueueHandleValid(pQueue, handle))
+    {
+        return INVALID_ACCESS;
+    }
+
+    int pos = pQueue->handlePos[handle];
+    if (pVal != NULL)
+    {
+        *pVal = pQueue->heap[pos].data;
+    }
+    freeQueueHandle(pQueue, handle);
+    (pQueue->len)--;
+
+    /* 用最后一个元素填补空位, 再按需上浮或下沉 */
+    if (pos != pQueue->len)
+    {
+        pQueue->heap[pos] = pQueue->heap[pQueue->len];
+        int movedHandle = pQueue->heap[pos].handle;
+        priorityQueueSiftUp(pQueue, pos);
+        priorityQueueSiftDown(pQueue, pQueue->handlePos[movedHandle]);
+    }
+    return ON_SUCCESS;
+}
+
+/* 句柄对应的元素是否还在队列中 */
+int priorityQueueContains(priorityQueue *pQueue, int handle)
+{
+    if (pQueue == NULL)
+    {
+        return 0;
+    }
+    return priorityQueueHandleValid(pQueue, handle) ? 1 : 0;
+}
+
+/* 队列大小 */
+int priorityQueueGetSize(priorityQueue *pQueue, int *pSize)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pSize != NULL)
+    {
+        *pSize = pQueue->len;
+    }
+    return pQueue->len;
+}
+
+/* 队列是否为空 */
+int priorityQueueIsEmpty(priorityQueue *pQueue)
+{
+    int size = 0;
+    priorityQueueGetSize(pQueue, &size);
+    return size == 0 ? 1 : 0;
+}
+
+/* 队列销毁 */
+int priorityQueueDestroy(priorityQueue *pQueue)
+{
+    if (pQueue == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    free(pQueue->heap);
+    free(pQueue->handlePos);
+    free(pQueue->freeHandles);
+    free(pQueue);
+    return ON_SUCCESS;
+}
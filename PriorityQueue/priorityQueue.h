@@ -0,0 +1,77 @@
+#ifndef __PRIORITY_QUEUE_H_
+#define __PRIORITY_QUEUE_H_
+
+#include "dynamicArray.h"
+
+/* 默认的叉数 */
+#define PRIORITY_QUEUE_DEFAULT_ARITY    4
+/* 默认的初始容量 */
+#define PRIORITY_QUEUE_INIT_CAPACITY    16
+
+/* 堆中的元素: 数据 + 句柄 */
+typedef struct priorityQueueEntry
+{
+    ELEMENTTYPE data;
+    /* 入队时分配的句柄, 用来修改优先级 */
+    int handle;
+} priorityQueueEntry;
+
+/*
+ * d 叉堆实现的优先队列, 元素连续存放在数组里.
+ * compareFunc(val1, val2) < 0 表示 val1 优先级更高 (先出队).
+ * 句柄是一个整数, handlePos[handle] 记录元素当前在堆数组中的下标, 出队后句柄会被复用.
+ */
+typedef struct priorityQueue
+{
+    /* 堆数组 */
+    priorityQueueEntry *heap;
+    /* 元素个数 */
+    int len;
+    /* 容量 */
+    int capacity;
+    /* 叉数 */
+    int arity;
+    /* 句柄 -> 堆数组下标 (-1 表示句柄空闲) */
+    int *handlePos;
+    /* 空闲句柄栈 */
+    int *freeHandles;
+    int freeNum;
+    /* 已经分配过的句柄个数 */
+    int handleNum;
+    int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2);
+} priorityQueue;
+
+/* 优先队列初始化 (arity < 2 时使用默认叉数) */
+int priorityQueueInit(priorityQueue **pQueue, int arity, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2));
+
+/* 入队 O(log_d n), pHandle 不为NULL时返回元素的句柄 */
+int priorityQueuePush(priorityQueue *pQueue, ELEMENTTYPE val, int *pHandle);
+
+/* 批量建堆 O(n): 把动态数组中的元素全部入队, pHandles 不为NULL时依次返回每个元素的句柄 */
+int priorityQueueHeapify(priorityQueue *pQueue, dynamicArray *pArray, int *pHandles);
+
+/* 查看优先级最高的元素 */
+int priorityQueueTop(priorityQueue *pQueue, ELEMENTTYPE *pVal);
+
+/* 出队 O(d * log_d n): 取出优先级最高的元素 */
+int priorityQueuePop(priorityQueue *pQueue, ELEMENTTYPE *pVal);
+
+/* 提高元素的优先级 (新值不能比原来的优先级低) */
+int priorityQueueDecreaseKey(priorityQueue *pQueue, int handle, ELEMENTTYPE val);
+
+/* 删除句柄对应的元素 */
+int priorityQueueRemove(priorityQueue *pQueue, int handle, ELEMENTTYPE *pVal);
+
+/* 句柄对应的元素是否还在队列中 */
+int priorityQueueContains(priorityQueue *pQueue, int handle);
+
+/* 队列大小 */
+int priorityQueueGetSize(priorityQueue *pQueue, int *pSize);
+
+/* 队列是否为空 */
+int priorityQueueIsEmpty(priorityQueue *pQueue);
+
+/* 队列销毁 */
+int priorityQueueDestroy(priorityQueue *pQueue);
+
+#endif // __PRIORITY_QUEUE_H_
@@ -8,25 +8,75 @@ typedef void * ELEMENTTYPE;
 #endif 
 
 
+/* 小数组优化: dynamicArrayInline 内部可以直接存放的元素个数 */
+#define DYNAMIC_ARRAY_INLINE_SIZE   8
+
 /* 避免头文件重复包含 */
 typedef struct dynamicArray
 {
     ELEMENTTYPE *data;  /* 数组的空间 */
     int len;            /* 数组的大小 */
     int capacity;       /* 数组的容量 */
+    int growthPolicy;   /* 扩容策略 */
+    int (*growthFunc)(int capacity);    /* 自定义扩容函数 */
+    int shrinkPolicy;   /* 缩容策略 */
+    int minCapacity;    /* 自动缩容的最小容量 */
+    int reallocCount;   /* 扩/缩容的次数 */
+    long long copyBytes;    /* 扩/缩容时搬移数据的字节数 */
+    int (*sortedCompareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2);   /* 有序模式的比较函数 (NULL 表示不是有序模式) */
+    ELEMENTTYPE *inlineData;    /* 所在 dynamicArrayInline 的内部空间 (NULL 表示没有), 这块空间不能 realloc/free */
 } dynamicArray;
 
+/* 带内部空间的动态数组 (小数组优化, 按需使用): 元素不超过 DYNAMIC_ARRAY_INLINE_SIZE 时数据存放在 storage 里, 此时结构体不能按值拷贝 */
+typedef struct dynamicArrayInline
+{
+    dynamicArray array;
+    ELEMENTTYPE storage[DYNAMIC_ARRAY_INLINE_SIZE];
+} dynamicArrayInline;
+
+/* Eytzinger 布局的只读查找表 (按二叉堆的顺序存放有序数组, 二分时访问更集中) */
+typedef struct dynamicArrayEytzinger
+{
+    ELEMENTTYPE *data;  /* 下标从1开始 */
+    int len;            /* 元素个数 */
+} dynamicArrayEytzinger;
+
+/* 扩容策略 */
+enum GROWTH_POLICY
+{
+    GROWTH_POLICY_1_5,      /* 1.5倍 */
+    GROWTH_POLICY_2,        /* 2倍 */
+    GROWTH_POLICY_GOLDEN,   /* 黄金分割 1.618倍 */
+    GROWTH_POLICY_CUSTOM,   /* 自定义扩容函数 */
+};
+
+/* 缩容策略 */
+enum SHRINK_POLICY
+{
+    SHRINK_POLICY_AUTO,     /* 大小低于容量1/4时缩到一半 */
+    SHRINK_POLICY_NONE,     /* 不自动缩容 */
+};
+
 /* API: application program interface. */
 /* 动态数组的初始化 */
 int dynamicArrayInit(dynamicArray *pArray, int capacity);
 
-/* 动态数组插入数据(默认查到数组的末尾) */
+/* 带内部空间的动态数组初始化 (元素不超过 DYNAMIC_ARRAY_INLINE_SIZE 时不需要申请堆内存), 之后通过 &pInline->array 使用 */
+int dynamicArrayInitInline(dynamicArrayInline *pInline);
+
+/* 动态数组插入数据(默认查到数组的末尾, 有序模式下按顺序插入) */
 int dynamicArrayInsertData(dynamicArray *pArray, ELEMENTTYPE val);
 
-/* 动态数组插入数据, 在指定位置插入 */
+/* 动态数组插入数据, 在指定位置插入 (有序模式下返回 INVALID_ACCESS) */
 int dynamicArrayAppointPosInsertData(dynamicArray *pArray, int pos, ELEMENTTYPE val);
 
-/* 动态数组修改指定位置的数据 */
+/* 动态数组批量插入数据, 在指定位置插入 num 个元素 (有序模式下返回 INVALID_ACCESS) */
+int dynamicArrayInsertRange(dynamicArray *pArray, int pos, ELEMENTTYPE *vals, int num);
+
+/* 动态数组批量插入数据(默认插到数组的末尾, 有序模式下排序后归并, O(n + k log k)) */
+int dynamicArrayAppendBatch(dynamicArray *pArray, ELEMENTTYPE *vals, int num);
+
+/* 动态数组修改指定位置的数据 (有序模式下返回 INVALID_ACCESS) */
 int dynamicArrayModifyAppointPosData(dynamicArray *pArray, int pos, ELEMENTTYPE val);
 
 /* 动态数组删除数据(默认情况下删除最后末尾的数据) */
@@ -35,9 +85,21 @@ int dynamicArrayDeleteData(dynamicArray *pArray);
 /* 动态数组删除指定位置数据 */
 int dynamicArrayDeleteAppointPosData(dynamicArray *pArray, int pos);
 
-/* 动态数组删除指定的元素 */
+/* 动态数组删除指定的元素 (compareFunc 和排序/二分查找相同, 返回0表示相等) */
 int dynamicArrayDeleteAppointData(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2));
 
+/* 动态数组截断: 只保留前 len 个元素 (len 为0时清空数组) */
+int dynamicArrayTruncate(dynamicArray *pArray, int len);
+
+/* 动态数组删除满足条件的元素 (一次遍历) */
+int dynamicArrayRemoveIf(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int *pRemoveNum);
+
+/* 动态数组删除满足条件的元素, 被删除的元素交给 destroyFunc 释放 */
+int dynamicArrayRemoveIfWithDestroy(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum);
+
+/* 动态数组只保留满足条件的元素 */
+int dynamicArrayRetainIf(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int *pRemoveNum);
+
 /* 动态数组的销毁 */
 int dynamicArrayDestroy(dynamicArray *pArray);
 
@@ -47,10 +109,61 @@ int dynamicArrayGetSize(dynamicArray *pArray, int *pSize);
 /* 获取数组的容量 */
 int dynamicArrayGetCapacity(dynamicArray *pArray, int *pCapacity);
 
+/* 设置扩容策略 (growthFunc 只在 GROWTH_POLICY_CUSTOM 时生效) */
+int dynamicArraySetGrowthPolicy(dynamicArray *pArray, int policy, int (*growthFunc)(int capacity));
+
+/* 设置缩容策略: 是否自动缩容, 以及缩容的最小容量 */
+int dynamicArraySetShrinkPolicy(dynamicArray *pArray, int policy, int minCapacity);
+
+/* 预留容量: 容量至少为 capacity */
+int dynamicArrayReserve(dynamicArray *pArray, int capacity);
+
+/* 释放多余的容量: 容量缩到和大小一致 */
+int dynamicArrayShrinkToFit(dynamicArray *pArray);
+
+/* 获取扩/缩容的统计信息 */
+int dynamicArrayGetGrowthStats(dynamicArray *pArray, int *pReallocCount, long long *pCopyBytes);
+
 /* 获取指定位置的元素数据 */
 int dynamicArrayGetAppointPosVal(dynamicArray *pArray, int pos, ELEMENTTYPE *pVal);
 
-/* 数组排序 */
+/* 数组排序 (compareFunc 返回值 <0, 0, >0 分别表示 val1 小于, 等于, 大于 val2) */
 int dynamicArrayAppointWaySort(dynamicArray *pArray, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2));
 
+/* 数组并行排序 (分段多线程排序后归并, 数据量小时退化为单线程排序) */
+int dynamicArrayParallelSort(dynamicArray *pArray, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int threadNum);
+
+/* 有序数组: 第一个大于等于 val 的位置 (都小于 val 时为 len) */
+int dynamicArrayLowerBound(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pPos);
+
+/* 有序数组: 第一个大于 val 的位置 (都小于等于 val 时为 len) */
+int dynamicArrayUpperBound(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pPos);
+
+/* 有序数组: 等于 val 的区间 [*pBegin, *pEnd) */
+int dynamicArrayEqualRange(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pBegin, int *pEnd);
+
+/* 有序数组: 二分查找 val, 找不到时 *pPos 为-1 */
+int dynamicArrayBinarySearch(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pPos);
+
+/* 有序数组: 按顺序插入 (插在相等元素的后面) */
+int dynamicArraySortedInsert(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2));
+
+/*
+ * 设置有序模式: compareFunc 不为NULL时先把已有元素排好序, 之后 InsertData/AppendBatch 都按顺序插入,
+ * 指定位置的插入和修改返回 INVALID_ACCESS, 保证 LowerBound/UpperBound/BinarySearch 的前提成立. 为NULL时关闭
+ */
+int dynamicArraySetSortedMode(dynamicArray *pArray, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2));
+
+/* 用有序数组构建 Eytzinger 布局的查找表 (适合只读的静态表) */
+int dynamicArrayEytzingerBuild(dynamicArray *pArray, dynamicArrayEytzinger *pEytz);
+
+/* Eytzinger 查找表: 第一个大于等于 val 的元素 */
+int dynamicArrayEytzingerLowerBound(dynamicArrayEytzinger *pEytz, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), ELEMENTTYPE *pVal);
+
+/* Eytzinger 查找表: 查找等于 val 的元素 */
+int dynamicArrayEytzingerSearch(dynamicArrayEytzinger *pEytz, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), ELEMENTTYPE *pVal);
+
+/* Eytzinger 查找表的销毁 */
+int dynamicArrayEytzingerDestroy(dynamicArrayEytzinger *pEytz);
+
 #endif // __DYNAMIC_ARRAY_H _
\ No newline at end of file
@@ -0,0 +1,705 @@
+#include "dynamicArraySimd.h"
+#include <stdatomic.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_ARCH_X86   1
+#include <immintrin.h>
+#else
+#define SIMD_ARCH_X86   0
+#endif
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    NOT_FIND = -1,
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 当前使用的指令集等级, -1表示还没有检测 (多个线程可能同时第一次调用, 用原子变量) */
+static _Atomic int g_simdLevel = -1;
+/* cpu支持的最高等级, -1表示还没有检测 */
+static _Atomic int g_simdMaxLevel = -1;
+
+/* 静态函数前置声明 */
+static int detectSimdLevel(void);
+static int getSimdMaxLevel(void);
+
+/* 通过cpuid检测cpu支持的指令集 */
+static int detectSimdLevel(void)
+{
+#if SIMD_ARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SIMD_LEVEL_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return SIMD_LEVEL_SSE2;
+    }
+#endif
+    return SIMD_LEVEL_SCALAR;
+}
+
+/* cpu支持的最高等级: 检测结果是确定的, 多个线程同时检测只会写入相同的值 */
+static int getSimdMaxLevel(void)
+{
+    int maxLevel = atomic_load_explicit(&g_simdMaxLevel, memory_order_relaxed);
+    if (maxLevel < 0)
+    {
+        maxLevel = detectSimdLevel();
+        atomic_store_explicit(&g_simdMaxLevel, maxLevel, memory_order_relaxed);
+    }
+    return maxLevel;
+}
+
+/* 获取当前使用的指令集等级 (第一次调用时通过cpuid检测) */
+int dynamicArraySimdGetLevel(void)
+{
+    int level = atomic_load_explicit(&g_simdLevel, memory_order_relaxed);
+    if (level < 0)
+    {
+        /* 只在还没有设置过时写入, 不覆盖其他线程 SetLevel 设置的等级 */
+        int expected = -1;
+        level = getSimdMaxLevel();
+        if (!atomic_compare_exchange_strong_explicit(&g_simdLevel, &expected, level, memory_order_relaxed, memory_order_relaxed))
+        {
+            level = expected;
+        }
+    }
+    return level;
+}
+
+/* 设置使用的指令集等级 (不能超过cpu支持的等级, 返回实际生效的等级) */
+int dynamicArraySimdSetLevel(int level)
+{
+    int maxLevel = getSimdMaxLevel();
+    if (level < SIMD_LEVEL_SCALAR)
+    {
+        level = SIMD_LEVEL_SCALAR;
+    }
+    if (level > maxLevel)
+    {
+        level = maxLevel;
+    }
+    atomic_store_explicit(&g_simdLevel, level, memory_order_relaxed);
+    return level;
+}
+
+/* ========================== 标量实现 ========================== */
+
+static int findFirstIntScalar(const int *data, int begin, int len, int val)
+{
+    for (int idx = begin; idx < len; idx++)
+    {
+        if (data[idx] == val)
+        {
+            return idx;
+        }
+    }
+    return NOT_FIND;
+}
+
+static int countIntScalar(const int *data, int begin, int len, int val)
+{
+    int count = 0;
+    for (int idx = begin; idx < len; idx++)
+    {
+        count += (data[idx] == val);
+    }
+    return count;
+}
+
+static void minMaxIntScalar(const int *data, int begin, int len, int *pMin, int *pMax)
+{
+    for (int idx = begin; idx < len; idx++)
+    {
+        if (data[idx] < *pMin)
+        {
+            *pMin = data[idx];
+        }
+        if (data[idx] > *pMax)
+        {
+            *pMax = data[idx];
+        }
+    }
+}
+
+static long long sumIntScalar(const int *data, int begin, int len)
+{
+    long long sum = 0;
+    for (int idx = begin; idx < len; idx++)
+    {
+        sum += data[idx];
+    }
+    return sum;
+}
+
+static int findFirstDoubleScalar(const double *data, int begin, int len, double val)
+{
+    for (int idx = begin; idx < len; idx++)
+    {
+        if (data[idx] == val)
+        {
+            return idx;
+        }
+    }
+    return NOT_FIND;
+}
+
+static int countDoubleScalar(const double *data, int begin, int len, double val)
+{
+    int count = 0;
+    for (int idx = begin; idx < len; idx++)
+    {
+        count += (data[idx] == val);
+    }
+    return count;
+}
+
+static void minMaxDoubleScalar(const double *data, int begin, int len, double *pMin, double *pMax)
+{
+    for (int idx = begin; idx < len; idx++)
+    {
+        if (data[idx] < *pMin)
+        {
+            *pMin = data[idx];
+        }
+        if (data[idx] > *pMax)
+        {
+            *pMax = data[idx];
+        }
+    }
+}
+
+static double sumDoubleScalar(const double *data, int begin, int len)
+{
+    double sum = 0;
+    for (int idx = begin; idx < len; idx++)
+    {
+        sum += data[idx];
+    }
+    return sum;
+}
+
+#if SIMD_ARCH_X86
+/* ========================== SSE2 实现 ========================== */
+
+__attribute__((target("sse2")))
+static int findFirstIntSse2(const int *data, int len, int val)
+{
+    __m128i target = _mm_set1_epi32(val);
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        __m128i cmp = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + idx)), target);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(cmp));
+        if (mask)
+        {
+            return idx + __builtin_ctz(mask);
+        }
+    }
+    return findFirstIntScalar(data, idx, len, val);
+}
+
+__attribute__((target("sse2")))
+static int countIntSse2(const int *data, int len, int val)
+{
+    __m128i target = _mm_set1_epi32(val);
+    /* 相等时比较结果是-1, 用减法累加 */
+    __m128i acc = _mm_setzero_si128();
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + idx)), target));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countIntScalar(data, idx, len, val);
+}
+
+__attribute__((target("sse2")))
+static void minMaxIntSse2(const int *data, int len, int *pMin, int *pMax)
+{
+    __m128i vMin = _mm_set1_epi32(*pMin);
+    __m128i vMax = _mm_set1_epi32(*pMax);
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        __m128i cur = _mm_loadu_si128((const __m128i *)(data + idx));
+        /* SSE2 没有 min_epi32, 用比较结果做掩码选择 */
+        __m128i lt = _mm_cmplt_epi32(cur, vMin);
+        vMin = _mm_or_si128(_mm_and_si128(lt, cur), _mm_andnot_si128(lt, vMin));
+        __m128i gt = _mm_cmpgt_epi32(cur, vMax);
+        vMax = _mm_or_si128(_mm_and_si128(gt, cur), _mm_andnot_si128(gt, vMax));
+    }
+    int mins[4];
+    int maxs[4];
+    _mm_storeu_si128((__m128i *)mins, vMin);
+    _mm_storeu_si128((__m128i *)maxs, vMax);
+    minMaxIntScalar(mins, 0, 4, pMin, pMax);
+    minMaxIntScalar(maxs, 0, 4, pMin, pMax);
+    minMaxIntScalar(data, idx, len, pMin, pMax);
+}
+
+__attribute__((target("sse2")))
+static long long sumIntSse2(const int *data, int len)
+{
+    __m128i acc = _mm_setzero_si128();
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        __m128i cur = _mm_loadu_si128((const __m128i *)(data + idx));
+        /* 符号扩展到64位再累加 */
+        __m128i sign = _mm_srai_epi32(cur, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(cur, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(cur, sign));
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return lanes[0] + lanes[1] + sumIntScalar(data, idx, len);
+}
+
+__attribute__((target("sse2")))
+static int findFirstDoubleSse2(const double *data, int len, double val)
+{
+    __m128d target = _mm_set1_pd(val);
+    int idx = 0;
+    for (; idx + 2 <= len; idx += 2)
+    {
+        int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + idx), target));
+        if (mask)
+        {
+            return idx + __builtin_ctz(mask);
+        }
+    }
+    return findFirstDoubleScalar(data, idx, len, val);
+}
+
+__attribute__((target("sse2")))
+static int countDoubleSse2(const double *data, int len, double val)
+{
+    __m128d target = _mm_set1_pd(val);
+    int count = 0;
+    int idx = 0;
+    for (; idx + 2 <= len; idx += 2)
+    {
+        count += __builtin_popcount(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(data + idx), target)));
+    }
+    return count + countDoubleScalar(data, idx, len, val);
+}
+
+__attribute__((target("sse2")))
+static void minMaxDoubleSse2(const double *data, int len, double *pMin, double *pMax)
+{
+    __m128d vMin = _mm_set1_pd(*pMin);
+    __m128d vMax = _mm_set1_pd(*pMax);
+    int idx = 0;
+    for (; idx + 2 <= len; idx += 2)
+    {
+        __m128d cur = _mm_loadu_pd(data + idx);
+        vMin = _mm_min_pd(vMin, cur);
+        vMax = _mm_max_pd(vMax, cur);
+    }
+    double mins[2];
+    double maxs[2];
+    _mm_storeu_pd(mins, vMin);
+    _mm_storeu_pd(maxs, vMax);
+    minMaxDoubleScalar(mins, 0, 2, pMin, pMax);
+    minMaxDoubleScalar(maxs, 0, 2, pMin, pMax);
+    minMaxDoubleScalar(data, idx, len, pMin, pMax);
+}
+
+__attribute__((target("sse2")))
+static double sumDoubleSse2(const double *data, int len)
+{
+    __m128d acc = _mm_setzero_pd();
+    int idx = 0;
+    for (; idx + 2 <= len; idx += 2)
+    {
+        acc = _mm_add_pd(acc, _mm_loadu_pd(data + idx));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, acc);
+    return lanes[0] + lanes[1] + sumDoubleScalar(data, idx, len);
+}
+
+/* ========================== AVX2 实现 ========================== */
+
+__attribute__((target("avx2")))
+static int findFirstIntAvx2(const int *data, int len, int val)
+{
+    __m256i target = _mm256_set1_epi32(val);
+    int idx = 0;
+    for (; idx + 8 <= len; idx += 8)
+    {
+        __m256i cmp = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + idx)), target);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+        if (mask)
+        {
+            return idx + __builtin_ctz(mask);
+        }
+    }
+    return findFirstIntScalar(data, idx, len, val);
+}
+
+__attribute__((target("avx2")))
+static int countIntAvx2(const int *data, int len, int val)
+{
+    __m256i target = _mm256_set1_epi32(val);
+    __m256i acc = _mm256_setzero_si256();
+    int idx = 0;
+    for (; idx + 8 <= len; idx += 8)
+    {
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + idx)), target));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    int count = 0;
+    for (int lane = 0; lane < 8; lane++)
+    {
+        count += lanes[lane];
+    }
+    return count + countIntScalar(data, idx, len, val);
+}
+
+__attribute__((target("avx2")))
+static void minMaxIntAvx2(const int *data, int len, int *pMin, int *pMax)
+{
+    __m256i vMin = _mm256_set1_epi32(*pMin);
+    __m256i vMax = _mm256_set1_epi32(*pMax);
+    int idx = 0;
+    for (; idx + 8 <= len; idx += 8)
+    {
+        __m256i cur = _mm256_loadu_si256((const __m256i *)(data + idx));
+        vMin = _mm256_min_epi32(vMin, cur);
+        vMax = _mm256_max_epi32(vMax, cur);
+    }
+    int mins[8];
+    int maxs[8];
+    _mm256_storeu_si256((__m256i *)mins, vMin);
+    _mm256_storeu_si256((__m256i *)maxs, vMax);
+    minMaxIntScalar(mins, 0, 8, pMin, pMax);
+    minMaxIntScalar(maxs, 0, 8, pMin, pMax);
+    minMaxIntScalar(data, idx, len, pMin, pMax);
+}
+
+__attribute__((target("avx2")))
+static long long sumIntAvx2(const int *data, int len)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int idx = 0;
+    for (; idx + 8 <= len; idx += 8)
+    {
+        __m256i cur = _mm256_loadu_si256((const __m256i *)(data + idx));
+        /* 符号扩展到64位再累加 */
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(cur)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(cur, 1)));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumIntScalar(data, idx, len);
+}
+
+__attribute__((target("avx2")))
+static int findFirstDoubleAvx2(const double *data, int len, double val)
+{
+    __m256d target = _mm256_set1_pd(val);
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + idx), target, _CMP_EQ_OQ));
+        if (mask)
+        {
+            return idx + __builtin_ctz(mask);
+        }
+    }
+    return findFirstDoubleScalar(data, idx, len, val);
+}
+
+__attribute__((target("avx2")))
+static int countDoubleAvx2(const double *data, int len, double val)
+{
+    __m256d target = _mm256_set1_pd(val);
+    int count = 0;
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        count += __builtin_popcount(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + idx), target, _CMP_EQ_OQ)));
+    }
+    return count + countDoubleScalar(data, idx, len, val);
+}
+
+__attribute__((target("avx2")))
+static void minMaxDoubleAvx2(const double *data, int len, double *pMin, double *pMax)
+{
+    __m256d vMin = _mm256_set1_pd(*pMin);
+    __m256d vMax = _mm256_set1_pd(*pMax);
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        __m256d cur = _mm256_loadu_pd(data + idx);
+        vMin = _mm256_min_pd(vMin, cur);
+        vMax = _mm256_max_pd(vMax, cur);
+    }
+    double mins[4];
+    double maxs[4];
+    _mm256_storeu_pd(mins, vMin);
+    _mm256_storeu_pd(maxs, vMax);
+    minMaxDoubleScalar(mins, 0, 4, pMin, pMax);
+    minMaxDoubleScalar(maxs, 0, 4, pMin, pMax);
+    minMaxDoubleScalar(data, idx, len, pMin, pMax);
+}
+
+__attribute__((target("avx2")))
+static double sumDoubleAvx2(const double *data, int len)
+{
+    __m256d acc = _mm256_setzero_pd();
+    int idx = 0;
+    for (; idx + 4 <= len; idx += 4)
+    {
+        acc = _mm256_add_pd(acc, _mm256_loadu_pd(data + idx));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumDoubleScalar(data, idx, len);
+}
+#endif
+
+/* ========================== 对外接口 ========================== */
+
+/* 查找第一个等于 val 的位置, 找不到 *pPos 为-1 */
+int dynamicArrayFindFirst_int(dynamicArray_int *pArray, int val, int *pPos)
+{
+    if (pArray == NULL || pPos == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        *pPos = findFirstIntAvx2(pArray->data, pArray->len, val);
+        break;
+    case SIMD_LEVEL_SSE2:
+        *pPos = findFirstIntSse2(pArray->data, pArray->len, val);
+        break;
+#endif
+    default:
+        *pPos = findFirstIntScalar(pArray->data, 0, pArray->len, val);
+        break;
+    }
+    return ON_SUCCESS;
+}
+
+/* 统计等于 val 的元素个数 */
+int dynamicArrayCount_int(dynamicArray_int *pArray, int val, int *pCount)
+{
+    if (pArray == NULL || pCount == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        *pCount = countIntAvx2(pArray->data, pArray->len, val);
+        break;
+    case SIMD_LEVEL_SSE2:
+        *pCount = countIntSse2(pArray->data, pArray->len, val);
+        break;
+#endif
+    default:
+        *pCount = countIntScalar(pArray->data, 0, pArray->len, val);
+        break;
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取最小值和最大值 (空数组返回 INVALID_ACCESS) */
+int dynamicArrayMinMax_int(dynamicArray_int *pArray, int *pMin, int *pMax)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pArray->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    /* 用第一个元素做初值 */
+    int minVal = pArray->data[0];
+    int maxVal = pArray->data[0];
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        minMaxIntAvx2(pArray->data, pArray->len, &minVal, &maxVal);
+        break;
+    case SIMD_LEVEL_SSE2:
+        minMaxIntSse2(pArray->data, pArray->len, &minVal, &maxVal);
+        break;
+#endif
+    default:
+        minMaxIntScalar(pArray->data, 0, pArray->len, &minVal, &maxVal);
+        break;
+    }
+
+    if (pMin != NULL)
+    {
+        *pMin = minVal;
+    }
+    if (pMax != NULL)
+    {
+        *pMax = maxVal;
+    }
+    return ON_SUCCESS;
+}
+
+/* 求和 (用64位累加, 避免溢出) */
+int dynamicArraySum_int(dynamicArray_int *pArray, long long *pSum)
+{
+    if (pArray == NULL || pSum == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        *pSum = sumIntAvx2(pArray->data, pArray->len);
+        break;
+    case SIMD_LEVEL_SSE2:
+        *pSum = sumIntSse2(pArray->data, pArray->len);
+        break;
+#endif
+    default:
+        *pSum = sumIntScalar(pArray->data, 0, pArray->len);
+        break;
+    }
+    return ON_SUCCESS;
+}
+
+/* 查找第一个等于 val 的位置, 找不到 *pPos 为-1 */
+int dynamicArrayFindFirst_double(dynamicArray_double *pArray, double val, int *pPos)
+{
+    if (pArray == NULL || pPos == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        *pPos = findFirstDoubleAvx2(pArray->data, pArray->len, val);
+        break;
+    case SIMD_LEVEL_SSE2:
+        *pPos = findFirstDoubleSse2(pArray->data, pArray->len, val);
+        break;
+#endif
+    default:
+        *pPos = findFirstDoubleScalar(pArray->data, 0, pArray->len, val);
+        break;
+    }
+    return ON_SUCCESS;
+}
+
+/* 统计等于 val 的元素个数 */
+int dynamicArrayCount_double(dynamicArray_double *pArray, double val, int *pCount)
+{
+    if (pArray == NULL || pCount == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        *pCount = countDoubleAvx2(pArray->data, pArray->len, val);
+        break;
+    case SIMD_LEVEL_SSE2:
+        *pCount = countDoubleSse2(pArray->data, pArray->len, val);
+        break;
+#endif
+    default:
+        *pCount = countDoubleScalar(pArray->data, 0, pArray->len, val);
+        break;
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取最小值和最大值 (空数组返回 INVALID_ACCESS, 数组中不能有NaN) */
+int dynamicArrayMinMax_double(dynamicArray_double *pArray, double *pMin, double *pMax)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pArray->len == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    double minVal = pArray->data[0];
+    double maxVal = pArray->data[0];
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        minMaxDoubleAvx2(pArray->data, pArray->len, &minVal, &maxVal);
+        break;
+    case SIMD_LEVEL_SSE2:
+        minMaxDoubleSse2(pArray->data, pArray->len, &minVal, &maxVal);
+        break;
+#endif
+    default:
+        minMaxDoubleScalar(pArray->data, 0, pArray->len, &minVal, &maxVal);
+        break;
+    }
+
+    if (pMin != NULL)
+    {
+        *pMin = minVal;
+    }
+    if (pMax != NULL)
+    {
+        *pMax = maxVal;
+    }
+    return ON_SUCCESS;
+}
+
+/* 求和 (向量化累加的顺序和标量不同, 结果可能有舍入误差) */
+int dynamicArraySum_double(dynamicArray_double *pArray, double *pSum)
+{
+    if (pArray == NULL || pSum == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    switch (dynamicArraySimdGetLevel())
+    {
+#if SIMD_ARCH_X86
+    case SIMD_LEVEL_AVX2:
+        *pSum = sumDoubleAvx2(pArray->data, pArray->len);
+        break;
+    case SIMD_LEVEL_SSE2:
+        *pSum = sumDoubleSse2(pArray->data, pArray->len);
+        break;
+#endif
+    default:
+        *pSum = sumDoubleScalar(pArray->data, 0, pArray->len);
+        break;
+    }
+    return ON_SUCCESS;
+}
@@ -0,0 +1,44 @@
+#ifndef __DYNAMIC_ARRAY_SIMD_H_
+#define __DYNAMIC_ARRAY_SIMD_H_
+
+#include "dynamicArrayTyped.h"
+
+/* 指令集等级 */
+enum SIMD_LEVEL
+{
+    SIMD_LEVEL_SCALAR,      /* 纯标量实现 */
+    SIMD_LEVEL_SSE2,        /* 128位 */
+    SIMD_LEVEL_AVX2,        /* 256位 */
+};
+
+/* 获取当前使用的指令集等级 (第一次调用时通过cpuid检测) */
+int dynamicArraySimdGetLevel(void);
+
+/* 设置使用的指令集等级 (不能超过cpu支持的等级, 返回实际生效的等级) */
+int dynamicArraySimdSetLevel(int level);
+
+/* 查找第一个等于 val 的位置, 找不到 *pPos 为-1 */
+int dynamicArrayFindFirst_int(dynamicArray_int *pArray, int val, int *pPos);
+
+/* 统计等于 val 的元素个数 */
+int dynamicArrayCount_int(dynamicArray_int *pArray, int val, int *pCount);
+
+/* 获取最小值和最大值 (空数组返回 INVALID_ACCESS) */
+int dynamicArrayMinMax_int(dynamicArray_int *pArray, int *pMin, int *pMax);
+
+/* 求和 (用64位累加, 避免溢出) */
+int dynamicArraySum_int(dynamicArray_int *pArray, long long *pSum);
+
+/* 查找第一个等于 val 的位置, 找不到 *pPos 为-1 */
+int dynamicArrayFindFirst_double(dynamicArray_double *pArray, double val, int *pPos);
+
+/* 统计等于 val 的元素个数 */
+int dynamicArrayCount_double(dynamicArray_double *pArray, double val, int *pCount);
+
+/* 获取最小值和最大值 (空数组返回 INVALID_ACCESS, 数组中不能有NaN) */
+int dynamicArrayMinMax_double(dynamicArray_double *pArray, double *pMin, double *pMax);
+
+/* 求和 (向量化累加的顺序和标量不同, 结果可能有舍入误差) */
+int dynamicArraySum_double(dynamicArray_double *pArray, double *pSum);
+
+#endif // __DYNAMIC_ARRAY_SIMD_H_
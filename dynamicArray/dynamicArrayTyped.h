@@ -0,0 +1,627 @@
+#ifndef __DYNAMIC_ARRAY_TYPED_H_
+#define __DYNAMIC_ARRAY_TYPED_H_
+
+/*
+ * 按元素类型生成的动态数组.
+ * dynamicArray 中存放的是 void*, 存 int 需要给每个值单独分配空间, 访问时还要多一次解引用.
+ * 这里用宏为每种元素类型生成一份代码, 元素直接连续存放在数组里.
+ *
+ * 用法:
+ *     DYNAMIC_ARRAY_GENERATE(int, int)
+ *     dynamicArray_int array;
+ *     dynamicArrayInit_int(&array, 10);
+ *     dynamicArrayInsertData_int(&array, 666);
+ *
+ * 和 dynamicArray 的区别:
+ *   - 比较函数/条件函数的参数是元素的指针 (const TYPE *), 元素较大时不需要拷贝.
+ *   - 固定按1.5倍扩容, 大小低于容量1/4时缩容: 没有生成扩/缩容策略 (SetGrowthPolicy/SetShrinkPolicy) 和统计接口 (GetGrowthStats).
+ *   - 没有生成并行排序 (ParallelSort), 需要时对 data 分段调用 AppointWaySort.
+ *   - 有序数组的查找只生成了 LowerBound/UpperBound/EqualRange/BinarySearch/SortedInsert,
+ *     没有有序模式 (SetSortedMode) 和 Eytzinger 查找表.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+/* 状态码 (和 dynamicArray.c 中的取值保持一致) */
+enum TYPED_ARRAY_STATUS_CODE
+{
+    TYPED_ARRAY_ON_SUCCESS,
+    TYPED_ARRAY_NULL_PTR,
+    TYPED_ARRAY_MALLOC_ERROR,
+    TYPED_ARRAY_INVALID_ACCESS,
+};
+
+#define TYPED_ARRAY_DEFAULT_SIZE    10
+/* 小于这个长度的区间使用插入排序 */
+#define TYPED_ARRAY_INSERTION_SORT_THRESHOLD    16
+
+/* NAME: 类型名后缀, TYPE: 元素类型 */
+#define DYNAMIC_ARRAY_GENERATE(NAME, TYPE)                                                                      \
+                                                                                                                \
+typedef struct dynamicArray_##NAME                                                                              \
+{                                                                                                               \
+    TYPE *data;         /* 数组的空间 */                                                                         \
+    int len;            /* 数组的大小 */                                                                         \
+    int capacity;       /* 数组的容量 */                                                                         \
+} dynamicArray_##NAME;                                                                                          \
+                                                                                                                \
+/* 调整数组容量 */                                                                                               \
+static inline int dynamicArrayResize_##NAME(dynamicArray_##NAME *pArray, int newCapacity)                       \
+{                                                                                                               \
+    if (newCapacity <= 0)                                                                                       \
+    {                                                                                                           \
+        newCapacity = 1;                                                                                        \
+    }                                                                                                           \
+    TYPE *newPtr = (TYPE *)realloc(pArray->data, sizeof(TYPE) * newCapacity);                                   \
+    if (newPtr == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_MALLOC_ERROR;                                                                        \
+    }                                                                                                           \
+    pArray->data = newPtr;                                                                                      \
+    pArray->capacity = newCapacity;                                                                             \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组的初始化 */                                                                                           \
+static inline int dynamicArrayInit_##NAME(dynamicArray_##NAME *pArray, int capacity)                            \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (capacity < 0)                                                                                           \
+    {                                                                                                           \
+        capacity = TYPED_ARRAY_DEFAULT_SIZE;                                                                    \
+    }                                                                                                           \
+    pArray->data = NULL;                                                                                        \
+    pArray->len = 0;                                                                                            \
+    pArray->capacity = 0;                                                                                       \
+    return dynamicArrayResize_##NAME(pArray, capacity);                                                         \
+}                                                                                                               \
+                                                                                                                \
+/* 预留容量: 容量至少为 capacity */                                                                              \
+static inline int dynamicArrayReserve_##NAME(dynamicArray_##NAME *pArray, int capacity)                         \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (capacity <= pArray->capacity)                                                                           \
+    {                                                                                                           \
+        return TYPED_ARRAY_ON_SUCCESS;                                                                          \
+    }                                                                                                           \
+    /* 按1.5倍递增, 直到容量足够 */                                                                              \
+    long long newCapacity = pArray->capacity;                                                                   \
+    while (newCapacity < capacity)                                                                              \
+    {                                                                                                           \
+        newCapacity = newCapacity + (newCapacity >> 1) + 1;                                                     \
+    }                                                                                                           \
+    if (newCapacity > 0x7fffffff)                                                                               \
+    {                                                                                                           \
+        newCapacity = capacity;                                                                                 \
+    }                                                                                                           \
+    return dynamicArrayResize_##NAME(pArray, (int)newCapacity);                                                 \
+}                                                                                                               \
+                                                                                                                \
+/* 释放多余的容量 */                                                                                             \
+static inline int dynamicArrayShrinkToFit_##NAME(dynamicArray_##NAME *pArray)                                   \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    return dynamicArrayResize_##NAME(pArray, pArray->len);                                                      \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组批量插入数据, 在指定位置插入 num 个元素 */                                                             \
+static inline int dynamicArrayInsertRange_##NAME(dynamicArray_##NAME *pArray, int pos, const TYPE *vals, int num) \
+{                                                                                                               \
+    if (pArray == NULL || (vals == NULL && num > 0))                                                            \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pos < 0 || pos > pArray->len || num < 0)                                                                \
+    {                                                                                                           \
+        return TYPED_ARRAY_INVALID_ACCESS;                                                                      \
+    }                                                                                                           \
+    int ret = dynamicArrayReserve_##NAME(pArray, pArray->len + num);                                            \
+    if (ret != TYPED_ARRAY_ON_SUCCESS)                                                                          \
+    {                                                                                                           \
+        return ret;                                                                                             \
+    }                                                                                                           \
+    memmove(pArray->data + pos + num, pArray->data + pos, sizeof(TYPE) * (pArray->len - pos));                  \
+    memcpy(pArray->data + pos, vals, sizeof(TYPE) * num);                                                       \
+    pArray->len += num;                                                                                         \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组插入数据, 在指定位置插入 */                                                                           \
+static inline int dynamicArrayAppointPosInsertData_##NAME(dynamicArray_##NAME *pArray, int pos, TYPE val)       \
+{                                                                                                               \
+    return dynamicArrayInsertRange_##NAME(pArray, pos, &val, 1);                                                \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组插入数据(默认插到数组的末尾) */                                                                       \
+static inline int dynamicArrayInsertData_##NAME(dynamicArray_##NAME *pArray, TYPE val)                          \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    /* 尾插的快速路径 */                                                                                         \
+    if (pArray->len == pArray->capacity)                                                                        \
+    {                                                                                                           \
+        int ret = dynamicArrayReserve_##NAME(pArray, pArray->len + 1);                                          \
+        if (ret != TYPED_ARRAY_ON_SUCCESS)                                                                      \
+        {                                                                                                       \
+            return ret;                                                                                         \
+        }                                                                                                       \
+    }                                                                                                           \
+    pArray->data[(pArray->len)++] = val;                                                                        \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组批量插入数据(默认插到数组的末尾) */                                                                   \
+static inline int dynamicArrayAppendBatch_##NAME(dynamicArray_##NAME *pArray, const TYPE *vals, int num)        \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    return dynamicArrayInsertRange_##NAME(pArray, pArray->len, vals, num);                                      \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组修改指定位置的数据 */                                                                                 \
+static inline int dynamicArrayModifyAppointPosData_##NAME(dynamicArray_##NAME *pArray, int pos, TYPE val)       \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pos < 0 || pos >= pArray->len)                                                                          \
+    {                                                                                                           \
+        return TYPED_ARRAY_INVALID_ACCESS;                                                                      \
+    }                                                                                                           \
+    pArray->data[pos] = val;                                                                                    \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 缩容: 大小低于容量的1/4时缩到一半 */                                                                          \
+static inline void dynamicArrayTryShrink_##NAME(dynamicArray_##NAME *pArray)                                    \
+{                                                                                                               \
+    if (pArray->capacity > TYPED_ARRAY_DEFAULT_SIZE && pArray->len < (pArray->capacity >> 2))                   \
+    {                                                                                                           \
+        dynamicArrayResize_##NAME(pArray, pArray->capacity - (pArray->capacity >> 1));                          \
+    }                                                                                                           \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组删除指定位置数据 */                                                                                   \
+static inline int dynamicArrayDeleteAppointPosData_##NAME(dynamicArray_##NAME *pArray, int pos)                 \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pos < 0 || pos >= pArray->len)                                                                          \
+    {                                                                                                           \
+        return TYPED_ARRAY_INVALID_ACCESS;                                                                      \
+    }                                                                                                           \
+    memmove(pArray->data + pos, pArray->data + pos + 1, sizeof(TYPE) * (pArray->len - pos - 1));                \
+    (pArray->len)--;                                                                                            \
+    dynamicArrayTryShrink_##NAME(pArray);                                                                       \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组删除数据(默认情况下删除最后末尾的数据) */                                                              \
+static inline int dynamicArrayDeleteData_##NAME(dynamicArray_##NAME *pArray)                                    \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    return dynamicArrayDeleteAppointPosData_##NAME(pArray, pArray->len - 1);                                    \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组删除指定的元素 (compareFunc 返回0表示相等, 和 dynamicArray 保持一致) */                                \
+static inline int dynamicArrayDeleteAppointData_##NAME(dynamicArray_##NAME *pArray, TYPE val,                   \
+                                                        int (*compareFunc)(const TYPE *val1, const TYPE *val2)) \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL)                                                                  \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    int writeIdx = 0;                                                                                           \
+    for (int readIdx = 0; readIdx < pArray->len; readIdx++)                                                     \
+    {                                                                                                           \
+        if (compareFunc(&val, &pArray->data[readIdx]) != 0)                                                     \
+        {                                                                                                       \
+            pArray->data[writeIdx++] = pArray->data[readIdx];                                                   \
+        }                                                                                                       \
+    }                                                                                                           \
+    pArray->len = writeIdx;                                                                                     \
+    dynamicArrayTryShrink_##NAME(pArray);                                                                       \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 按删除后的大小一次算好缩容后的容量 (规则和逐个删除时的缩容一致) */                                           \
+static inline void dynamicArrayBatchShrink_##NAME(dynamicArray_##NAME *pArray)                                  \
+{                                                                                                               \
+    int capacity = pArray->capacity;                                                                            \
+    while (capacity > TYPED_ARRAY_DEFAULT_SIZE && pArray->len < (capacity >> 2))                                \
+    {                                                                                                           \
+        capacity -= capacity >> 1;                                                                              \
+    }                                                                                                           \
+    if (capacity != pArray->capacity)                                                                           \
+    {                                                                                                           \
+        dynamicArrayResize_##NAME(pArray, capacity);                                                            \
+    }                                                                                                           \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组截断: 只保留前 len 个元素 (len 为0时清空数组) */                                                     \
+static inline int dynamicArrayTruncate_##NAME(dynamicArray_##NAME *pArray, int len)                             \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (len < 0 || len > pArray->len)                                                                           \
+    {                                                                                                           \
+        return TYPED_ARRAY_INVALID_ACCESS;                                                                      \
+    }                                                                                                           \
+    pArray->len = len;                                                                                          \
+    dynamicArrayBatchShrink_##NAME(pArray);                                                                     \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 按条件压缩数组: keepMatch为0时删除满足条件的元素, 为1时保留满足条件的元素 */                                 \
+static inline int dynamicArrayCompact_##NAME(dynamicArray_##NAME *pArray, int (*predicate)(const TYPE *val, void *ctx), \
+                                             void *ctx, int keepMatch, int (*destroyFunc)(TYPE *val), int *pRemoveNum) \
+{                                                                                                               \
+    if (pArray == NULL || predicate == NULL)                                                                    \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    int writeIdx = 0;                                                                                           \
+    for (int readIdx = 0; readIdx < pArray->len; readIdx++)                                                     \
+    {                                                                                                           \
+        int match = predicate(&pArray->data[readIdx], ctx) ? 1 : 0;                                             \
+        if (match == keepMatch)                                                                                 \
+        {                                                                                                       \
+            pArray->data[writeIdx++] = pArray->data[readIdx];                                                   \
+        }                                                                                                       \
+        else if (destroyFunc != NULL)                                                                           \
+        {                                                                                                       \
+            destroyFunc(&pArray->data[readIdx]);                                                                \
+        }                                                                                                       \
+    }                                                                                                           \
+    if (pRemoveNum != NULL)                                                                                     \
+    {                                                                                                           \
+        *pRemoveNum = pArray->len - writeIdx;                                                                   \
+    }                                                                                                           \
+    pArray->len = writeIdx;                                                                                     \
+    dynamicArrayBatchShrink_##NAME(pArray);                                                                     \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组删除满足条件的元素 (一次遍历) */                                                                     \
+static inline int dynamicArrayRemoveIf_##NAME(dynamicArray_##NAME *pArray, int (*predicate)(const TYPE *val, void *ctx), \
+                                              void *ctx, int *pRemoveNum)                                       \
+{                                                                                                               \
+    return dynamicArrayCompact_##NAME(pArray, predicate, ctx, 0, NULL, pRemoveNum);                             \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组删除满足条件的元素, 被删除的元素交给 destroyFunc 释放 (元素里有指针时使用) */                        \
+static inline int dynamicArrayRemoveIfWithDestroy_##NAME(dynamicArray_##NAME *pArray,                           \
+                                                         int (*predicate)(const TYPE *val, void *ctx), void *ctx, \
+                                                         int (*destroyFunc)(TYPE *val), int *pRemoveNum)        \
+{                                                                                                               \
+    return dynamicArrayCompact_##NAME(pArray, predicate, ctx, 0, destroyFunc, pRemoveNum);                      \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组只保留满足条件的元素 */                                                                              \
+static inline int dynamicArrayRetainIf_##NAME(dynamicArray_##NAME *pArray, int (*predicate)(const TYPE *val, void *ctx), \
+                                              void *ctx, int *pRemoveNum)                                       \
+{                                                                                                               \
+    return dynamicArrayCompact_##NAME(pArray, predicate, ctx, 1, NULL, pRemoveNum);                             \
+}                                                                                                               \
+                                                                                                                \
+/* 动态数组的销毁 */                                                                                             \
+static inline int dynamicArrayDestroy_##NAME(dynamicArray_##NAME *pArray)                                       \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pArray->data != NULL)                                                                                   \
+    {                                                                                                           \
+        free(pArray->data);                                                                                     \
+        pArray->data = NULL;                                                                                    \
+    }                                                                                                           \
+    pArray->len = 0;                                                                                            \
+    pArray->capacity = 0;                                                                                       \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 获取数组的大小 */                                                                                             \
+static inline int dynamicArrayGetSize_##NAME(dynamicArray_##NAME *pArray, int *pSize)                           \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pSize != NULL)                                                                                          \
+    {                                                                                                           \
+        *pSize = pArray->len;                                                                                   \
+    }                                                                                                           \
+    return pArray->len;                                                                                         \
+}                                                                                                               \
+                                                                                                                \
+/* 获取数组的容量 */                                                                                             \
+static inline int dynamicArrayGetCapacity_##NAME(dynamicArray_##NAME *pArray, int *pCapacity)                   \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pCapacity != NULL)                                                                                      \
+    {                                                                                                           \
+        *pCapacity = pArray->capacity;                                                                          \
+    }                                                                                                           \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 获取指定位置的元素数据 */                                                                                     \
+static inline int dynamicArrayGetAppointPosVal_##NAME(dynamicArray_##NAME *pArray, int pos, TYPE *pVal)         \
+{                                                                                                               \
+    if (pArray == NULL)                                                                                         \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pos < 0 || pos >= pArray->len)                                                                          \
+    {                                                                                                           \
+        return TYPED_ARRAY_INVALID_ACCESS;                                                                      \
+    }                                                                                                           \
+    if (pVal)                                                                                                   \
+    {                                                                                                           \
+        *pVal = pArray->data[pos];                                                                              \
+    }                                                                                                           \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 插入排序 [begin, end): 严格大于才后移, 相等元素保持原来的顺序 */                                             \
+static inline void dynamicArrayInsertionSort_##NAME(TYPE *data, int begin, int end,                             \
+                                                    int (*compareFunc)(const TYPE *val1, const TYPE *val2))     \
+{                                                                                                               \
+    for (int idx = begin + 1; idx < end; idx++)                                                                 \
+    {                                                                                                           \
+        TYPE val = data[idx];                                                                                   \
+        int pos = idx;                                                                                          \
+        while (pos > begin && compareFunc(&data[pos - 1], &val) > 0)                                            \
+        {                                                                                                       \
+            data[pos] = data[pos - 1];                                                                          \
+            pos--;                                                                                              \
+        }                                                                                                       \
+        data[pos] = val;                                                                                        \
+    }                                                                                                           \
+}                                                                                                               \
+                                                                                                                \
+/* 堆的下沉 (大顶堆), 堆的区间从 base 开始, 大小为 size */                                                      \
+static inline void dynamicArrayHeapSiftDown_##NAME(TYPE *base, int idx, int size,                               \
+                                                   int (*compareFunc)(const TYPE *val1, const TYPE *val2))      \
+{                                                                                                               \
+    TYPE val = base[idx];                                                                                       \
+    int child = 0;                                                                                              \
+    while ((child = (idx << 1) + 1) < size)                                                                     \
+    {                                                                                                           \
+        if (child + 1 < size && compareFunc(&base[child + 1], &base[child]) > 0)                                \
+        {                                                                                                       \
+            child++;                                                                                            \
+        }                                                                                                       \
+        if (compareFunc(&base[child], &val) <= 0)                                                               \
+        {                                                                                                       \
+            break;                                                                                              \
+        }                                                                                                       \
+        base[idx] = base[child];                                                                                \
+        idx = child;                                                                                            \
+    }                                                                                                           \
+    base[idx] = val;                                                                                            \
+}                                                                                                               \
+                                                                                                                \
+/* 堆排序 [begin, end): 快排递归过深时的兜底 */                                                                 \
+static inline void dynamicArrayHeapSort_##NAME(TYPE *data, int begin, int end,                                  \
+                                               int (*compareFunc)(const TYPE *val1, const TYPE *val2))          \
+{                                                                                                               \
+    TYPE *base = data + begin;                                                                                  \
+    int size = end - begin;                                                                                     \
+    for (int idx = (size >> 1) - 1; idx >= 0; idx--)                                                            \
+    {                                                                                                           \
+        dynamicArrayHeapSiftDown_##NAME(base, idx, size, compareFunc);                                          \
+    }                                                                                                           \
+    for (int last = size - 1; last > 0; last--)                                                                 \
+    {                                                                                                           \
+        TYPE tmp = base[0];                                                                                     \
+        base[0] = base[last];                                                                                   \
+        base[last] = tmp;                                                                                       \
+        dynamicArrayHeapSiftDown_##NAME(base, 0, last, compareFunc);                                            \
+    }                                                                                                           \
+}                                                                                                               \
+                                                                                                                \
+/* 内省排序 [begin, end): 三数取中快排 + 小区间插入排序 + 递归过深改用堆排序 */                                 \
+static inline void dynamicArrayIntroSort_##NAME(TYPE *data, int begin, int end, int depthLimit,                 \
+                                                int (*compareFunc)(const TYPE *val1, const TYPE *val2))         \
+{                                                                                                               \
+    while (end - begin > TYPED_ARRAY_INSERTION_SORT_THRESHOLD)                                                  \
+    {                                                                                                           \
+        if (depthLimit == 0)                                                                                    \
+        {                                                                                                       \
+            dynamicArrayHeapSort_##NAME(data, begin, end, compareFunc);                                         \
+            return;                                                                                             \
+        }                                                                                                       \
+        depthLimit--;                                                                                           \
+                                                                                                                \
+        /* 三数取中作为基准, 放到区间开头 */                                                                    \
+        int a = begin, b = begin + ((end - begin) >> 1), c = end - 1;                                           \
+        int pivotIdx = 0;                                                                                       \
+        if (compareFunc(&data[a], &data[b]) < 0)                                                                \
+        {                                                                                                       \
+            pivotIdx = compareFunc(&data[b], &data[c]) < 0 ? b : (compareFunc(&data[a], &data[c]) < 0 ? c : a); \
+        }                                                                                                       \
+        else                                                                                                    \
+        {                                                                                                       \
+            pivotIdx = compareFunc(&data[a], &data[c]) < 0 ? a : (compareFunc(&data[b], &data[c]) < 0 ? c : b); \
+        }                                                                                                       \
+        TYPE pivot = data[pivotIdx];                                                                            \
+        data[pivotIdx] = data[begin];                                                                           \
+        data[begin] = pivot;                                                                                    \
+                                                                                                                \
+        /* Hoare 划分 */                                                                                        \
+        int left = begin;                                                                                       \
+        int right = end;                                                                                        \
+        while (1)                                                                                               \
+        {                                                                                                       \
+            do                                                                                                  \
+            {                                                                                                   \
+                left++;                                                                                         \
+            } while (left < end && compareFunc(&data[left], &pivot) < 0);                                       \
+            do                                                                                                  \
+            {                                                                                                   \
+                right--;                                                                                        \
+            } while (compareFunc(&data[right], &pivot) > 0);                                                    \
+            if (left >= right)                                                                                  \
+            {                                                                                                   \
+                break;                                                                                          \
+            }                                                                                                   \
+            TYPE tmp = data[left];                                                                              \
+            data[left] = data[right];                                                                           \
+            data[right] = tmp;                                                                                  \
+        }                                                                                                       \
+        data[begin] = data[right];                                                                              \
+        data[right] = pivot;                                                                                    \
+                                                                                                                \
+        /* 递归处理较小的一半, 较大的一半继续循环 */                                                            \
+        if (right - begin < end - right - 1)                                                                    \
+        {                                                                                                       \
+            dynamicArrayIntroSort_##NAME(data, begin, right, depthLimit, compareFunc);                          \
+            begin = right + 1;                                                                                  \
+        }                                                                                                       \
+        else                                                                                                    \
+        {                                                                                                       \
+            dynamicArrayIntroSort_##NAME(data, right + 1, end, depthLimit, compareFunc);                        \
+            end = right;                                                                                        \
+        }                                                                                                       \
+    }                                                                                                           \
+    dynamicArrayInsertionSort_##NAME(data, begin, end, compareFunc);                                            \
+}                                                                                                               \
+                                                                                                                \
+/* 数组排序 (compareFunc 返回值 <0, 0, >0 分别表示 val1 小于, 等于, 大于 val2) */                               \
+static inline int dynamicArrayAppointWaySort_##NAME(dynamicArray_##NAME *pArray,                                \
+                                                    int (*compareFunc)(const TYPE *val1, const TYPE *val2))     \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL)                                                                  \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    if (pArray->len > 1)                                                                                        \
+    {                                                                                                           \
+        int depthLimit = 0;                                                                                     \
+        for (int size = pArray->len; size > 1; size >>= 1)                                                      \
+        {                                                                                                       \
+            depthLimit += 2;                                                                                    \
+        }                                                                                                       \
+        dynamicArrayIntroSort_##NAME(pArray->data, 0, pArray->len, depthLimit, compareFunc);                    \
+    }                                                                                                           \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 有序数组二分: upper 为0时返回第一个大于等于 val 的位置, 为1时返回第一个大于 val 的位置 */                    \
+static inline int dynamicArraySortedBound_##NAME(const TYPE *data, int len, const TYPE *val, int upper,         \
+                                                 int (*compareFunc)(const TYPE *val1, const TYPE *val2))        \
+{                                                                                                               \
+    int begin = 0;                                                                                              \
+    while (len > 0)                                                                                             \
+    {                                                                                                           \
+        int half = len >> 1;                                                                                    \
+        int cmp = compareFunc(&data[begin + half], val);                                                        \
+        if (cmp < 0 || (upper && cmp == 0))                                                                     \
+        {                                                                                                       \
+            begin += half + 1;                                                                                  \
+            len -= half + 1;                                                                                    \
+        }                                                                                                       \
+        else                                                                                                    \
+        {                                                                                                       \
+            len = half;                                                                                         \
+        }                                                                                                       \
+    }                                                                                                           \
+    return begin;                                                                                               \
+}                                                                                                               \
+                                                                                                                \
+/* 有序数组: 第一个大于等于 val 的位置 (都小于 val 时为 len) */                                                 \
+static inline int dynamicArrayLowerBound_##NAME(dynamicArray_##NAME *pArray, TYPE val,                          \
+                                                int (*compareFunc)(const TYPE *val1, const TYPE *val2), int *pPos) \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL || pPos == NULL)                                                  \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    *pPos = dynamicArraySortedBound_##NAME(pArray->data, pArray->len, &val, 0, compareFunc);                    \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 有序数组: 第一个大于 val 的位置 (都小于等于 val 时为 len) */                                                 \
+static inline int dynamicArrayUpperBound_##NAME(dynamicArray_##NAME *pArray, TYPE val,                          \
+                                                int (*compareFunc)(const TYPE *val1, const TYPE *val2), int *pPos) \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL || pPos == NULL)                                                  \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    *pPos = dynamicArraySortedBound_##NAME(pArray->data, pArray->len, &val, 1, compareFunc);                    \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 有序数组: 等于 val 的区间 [*pBegin, *pEnd) */                                                                \
+static inline int dynamicArrayEqualRange_##NAME(dynamicArray_##NAME *pArray, TYPE val,                          \
+                                                int (*compareFunc)(const TYPE *val1, const TYPE *val2),         \
+                                                int *pBegin, int *pEnd)                                         \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL || pBegin == NULL || pEnd == NULL)                                \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    *pBegin = dynamicArraySortedBound_##NAME(pArray->data, pArray->len, &val, 0, compareFunc);                  \
+    *pEnd = *pBegin + dynamicArraySortedBound_##NAME(pArray->data + *pBegin, pArray->len - *pBegin, &val, 1,    \
+                                                     compareFunc);                                              \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 有序数组: 二分查找 val, 找不到时 *pPos 为-1 */                                                               \
+static inline int dynamicArrayBinarySearch_##NAME(dynamicArray_##NAME *pArray, TYPE val,                        \
+                                                  int (*compareFunc)(const TYPE *val1, const TYPE *val2), int *pPos) \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL || pPos == NULL)                                                  \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    int pos = dynamicArraySortedBound_##NAME(pArray->data, pArray->len, &val, 0, compareFunc);                  \
+    *pPos = (pos < pArray->len && compareFunc(&pArray->data[pos], &val) == 0) ? pos : -1;                       \
+    return TYPED_ARRAY_ON_SUCCESS;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+/* 有序数组: 按顺序插入 (插在相等元素的后面) */                                                                 \
+static inline int dynamicArraySortedInsert_##NAME(dynamicArray_##NAME *pArray, TYPE val,                        \
+                                                  int (*compareFunc)(const TYPE *val1, const TYPE *val2))       \
+{                                                                                                               \
+    if (pArray == NULL || compareFunc == NULL)                                                                  \
+    {                                                                                                           \
+        return TYPED_ARRAY_NULL_PTR;                                                                            \
+    }                                                                                                           \
+    int pos = dynamicArraySortedBound_##NAME(pArray->data, pArray->len, &val, 1, compareFunc);                  \
+    return dynamicArrayInsertRange_##NAME(pArray, pos, &val, 1);                                                \
+}
+
+/* 常用的基础类型直接生成 */
+DYNAMIC_ARRAY_GENERATE(int, int)
+DYNAMIC_ARRAY_GENERATE(double, double)
+
+#endif // __DYNAMIC_ARRAY_TYPED_H_
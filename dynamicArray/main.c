@@ -1,10 +1,22 @@
 #include <stdio.h>
 #include "dynamicArray.h"
+#include "dynamicArrayTyped.h"
 #include <string.h>
 
 #define BUFFER_SIZE 20
 #define DEFAULT_NUM 6
 
+/* 置1: 在每个指令集等级下运行SIMD函数, 和标量结果对比 */
+#define RUN_SIMD_CHECK  0
+
+#if RUN_SIMD_CHECK
+#include "dynamicArraySimd.h"
+
+/* 测试长度: 大多数不是向量宽度的整数倍, 覆盖尾部处理 */
+static const int g_simdCheckLens[] = {0, 1, 3, 7, 13, 31, 1001};
+#define SIMD_CHECK_LEN_NUM  (int)(sizeof(g_simdCheckLens) / sizeof(g_simdCheckLens[0]))
+#endif
+
 typedef struct stuInfo
 {
     int age;
@@ -17,14 +29,110 @@ int compareData(void *arg1, void *arg2)
     int num1 = *(int *)arg1;
     int num2 = *(int *)arg2;
 
-    return num1 == num2 ? 1 : 0;
+    /* 和排序/二分查找的比较函数一致: 返回0表示相等 */
+    return num1 < num2 ? -1 : (num1 > num2 ? 1 : 0);
 }
+
+#if RUN_SIMD_CHECK
+/* 对每个长度, 以标量结果为基准, 检查 SSE2/AVX2 的结果是否一致. 返回不一致的个数 */
+static int simdLevelCheck(void)
+{
+    int oldLevel = dynamicArraySimdGetLevel();
+    int errorNum = 0;
+
+    for (int lenIdx = 0; lenIdx < SIMD_CHECK_LEN_NUM; lenIdx++)
+    {
+        int len = g_simdCheckLens[lenIdx];
+        dynamicArray_int intArray;
+        dynamicArray_double doubleArray;
+        dynamicArrayInit_int(&intArray, len);
+        dynamicArrayInit_double(&doubleArray, len);
+
+        /* 取值范围小一些, 保证有重复的元素; 最小值/最大值放在最后一个位置, 检查尾部 */
+        unsigned int seed = 12345u + (unsigned int)len;
+        for (int idx = 0; idx < len; idx++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            int val = (int)((seed >> 16) % 64) - 32;
+            if (idx == len - 1)
+            {
+                val = (len % 2) ? 1000 : -1000;
+            }
+            dynamicArrayInsertData_int(&intArray, val);
+            dynamicArrayInsertData_double(&doubleArray, val * 0.5);
+        }
+        /* 要找的值: 最后一个元素 (只出现一次) 和 一个不存在的值 */
+        int findVal = len > 0 ? intArray.data[len - 1] : 7;
+        int missVal = 12345;
+
+        int refRet[4] = {0};
+        int refPos = 0, refMissPos = 0, refCount = 0, refMin = 0, refMax = 0;
+        long long refSum = 0;
+        int refDPos = 0, refDCount = 0;
+        double refDMin = 0, refDMax = 0, refDSum = 0;
+
+        for (int level = SIMD_LEVEL_SCALAR; level <= SIMD_LEVEL_AVX2; level++)
+        {
+            if (dynamicArraySimdSetLevel(level) != level)
+            {
+                /* cpu不支持这个等级 */
+                continue;
+            }
+
+            int pos = 0, missPos = 0, count = 0, minVal = 0, maxVal = 0;
+            long long sum = 0;
+            int dPos = 0, dCount = 0;
+            double dMin = 0, dMax = 0, dSum = 0;
+            int ret[4] = {0};
+
+            dynamicArrayFindFirst_int(&intArray, findVal, &pos);
+            dynamicArrayFindFirst_int(&intArray, missVal, &missPos);
+            dynamicArrayCount_int(&intArray, 0, &count);
+            ret[0] = dynamicArrayMinMax_int(&intArray, &minVal, &maxVal);
+            ret[1] = dynamicArraySum_int(&intArray, &sum);
+            dynamicArrayFindFirst_double(&doubleArray, findVal * 0.5, &dPos);
+            dynamicArrayCount_double(&doubleArray, 0.0, &dCount);
+            ret[2] = dynamicArrayMinMax_double(&doubleArray, &dMin, &dMax);
+            ret[3] = dynamicArraySum_double(&doubleArray, &dSum);
+
+            if (level == SIMD_LEVEL_SCALAR)
+            {
+                memcpy(refRet, ret, sizeof(ret));
+                refPos = pos, refMissPos = missPos, refCount = count, refMin = minVal, refMax = maxVal, refSum = sum;
+                refDPos = dPos, refDCount = dCount, refDMin = dMin, refDMax = dMax, refDSum = dSum;
+                continue;
+            }
+
+            /* 向量化求和的累加顺序不同, double 允许舍入误差 */
+            double diff = dSum - refDSum;
+            if (memcmp(refRet, ret, sizeof(ret)) != 0 || pos != refPos || missPos != refMissPos || count != refCount ||
+                minVal != refMin || maxVal != refMax || sum != refSum || dPos != refDPos || dCount != refDCount ||
+                dMin != refDMin || dMax != refDMax || diff > 1e-9 || diff < -1e-9)
+            {
+                printf("simd mismatch: level:%d len:%d\n", level, len);
+                errorNum++;
+            }
+        }
+
+        dynamicArrayDestroy_int(&intArray);
+        dynamicArrayDestroy_double(&doubleArray);
+    }
+
+    dynamicArraySimdSetLevel(oldLevel);
+    printf("simd check: max level:%d, mismatch:%d\n", oldLevel, errorNum);
+    return errorNum;
+}
+#endif
+
 int main()
 {
     dynamicArray array;
     /* 初始化 */
     dynamicArrayInit(&array, BUFFER_SIZE);
-#if 0
+#if RUN_SIMD_CHECK
+    simdLevelCheck();
+    dynamicArrayDestroy(&array);
+#elif 0
     /* 模块化 */
     {
         /* 插入数据 */
@@ -162,6 +270,28 @@ int main()
         dynamicArrayGetAppointPosVal(&array, idx, (void *)&val);
         printf("val:%d\n", *val);
     }
+#elif 0
+    /* 元素直接存放在数组里, 不需要传地址 */
+    dynamicArray_int intArray;
+    dynamicArrayInit_int(&intArray, BUFFER_SIZE);
+
+    for (int idx = 0; idx < DEFAULT_NUM; idx++)
+    {
+        dynamicArrayInsertData_int(&intArray, idx);
+    }
+
+    int size = 0;
+    dynamicArrayGetSize_int(&intArray, &size);
+    printf("size:%d\n", size);
+
+    int val = 0;
+    for (int idx = 0; idx < size; idx++)
+    {
+        dynamicArrayGetAppointPosVal_int(&intArray, idx, &val);
+        printf("val:%d\n", val);
+    }
+
+    dynamicArrayDestroy_int(&intArray);
 #else
     stuInfo stu1, stu2, stu3;
     memset(&stu1, 0, sizeof(stu1));
@@ -7,13 +7,54 @@
 typedef void * ELEMENTTYPE;
 #endif 
 
+/* 小数组优化: dynamicArrayInline 内部可以直接存放的元素个数 */
+#define DYNAMIC_ARRAY_INLINE_SIZE   8
+
 /* 避免头文件重复包含 */
 typedef struct dynamicArray
 {
     ELEMENTTYPE *data;  /* 数组的空间 */
     int len;            /* 数组的大小 */
     int capacity;       /* 数组的容量 */
+    int growthPolicy;   /* 扩容策略 */
+    int (*growthFunc)(int capacity);    /* 自定义扩容函数 */
+    int shrinkPolicy;   /* 缩容策略 */
+    int minCapacity;    /* 自动缩容的最小容量 */
+    int reallocCount;   /* 扩/缩容的次数 */
+    long long copyBytes;    /* 扩/缩容时搬移数据的字节数 */
+    int (*sortedCompareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2);   /* 有序模式的比较函数 (NULL 表示不是有序模式) */
+    ELEMENTTYPE *inlineData;    /* 所在 dynamicArrayInline 的内部空间 (NULL 表示没有), 这块空间不能 realloc/free */
 } dynamicArray;
 
+/* 带内部空间的动态数组 (小数组优化, 按需使用): 元素不超过 DYNAMIC_ARRAY_INLINE_SIZE 时数据存放在 storage 里, 此时结构体不能按值拷贝 */
+typedef struct dynamicArrayInline
+{
+    dynamicArray array;
+    ELEMENTTYPE storage[DYNAMIC_ARRAY_INLINE_SIZE];
+} dynamicArrayInline;
+
+/* Eytzinger 布局的只读查找表 (按二叉堆的顺序存放有序数组, 二分时访问更集中) */
+typedef struct dynamicArrayEytzinger
+{
+    ELEMENTTYPE *data;  /* 下标从1开始 */
+    int len;            /* 元素个数 */
+} dynamicArrayEytzinger;
+
+/* 扩容策略 */
+enum GROWTH_POLICY
+{
+    GROWTH_POLICY_1_5,      /* 1.5倍 */
+    GROWTH_POLICY_2,        /* 2倍 */
+    GROWTH_POLICY_GOLDEN,   /* 黄金分割 1.618倍 */
+    GROWTH_POLICY_CUSTOM,   /* 自定义扩容函数 */
+};
+
+/* 缩容策略 */
+enum SHRINK_POLICY
+{
+    SHRINK_POLICY_AUTO,     /* 大小低于容量1/4时缩到一半 */
+    SHRINK_POLICY_NONE,     /* 不自动缩容 */
+};
+
 
 #endif  //__COMMON_H_
\ No newline at end of file
@@ -0,0 +1,313 @@
+#include "concurrentStack.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 入栈者在消除数组里等待配对的自旋次数 */
+#define ELIMINATION_SPIN_TIMES  64
+
+/* 版本号 + 下标 的打包与拆包 */
+#define TAGGED_INDEX(tagged)            ((unsigned int)((tagged) & 0xffffffffULL))
+#define TAGGED_TAG(tagged)              ((unsigned int)((tagged) >> 32))
+#define MAKE_TAGGED(tag, index)         (((unsigned long long)(tag) << 32) | (unsigned long long)(index))
+
+/* 静态函数前置声明 */
+static concurrentStackNode * getStackNode(concurrentStack *pStack, unsigned int index);
+static unsigned int taggedListPop(concurrentStack *pStack, _Atomic unsigned long long *pHead);
+static void taggedListPush(concurrentStack *pStack, _Atomic unsigned long long *pHead, unsigned int index);
+static unsigned int allocStackNode(concurrentStack *pStack);
+static unsigned int eliminationRandom(void);
+
+/* 根据下标得到结点 (下标从1开始) */
+static concurrentStackNode * getStackNode(concurrentStack *pStack, unsigned int index)
+{
+    unsigned int pos = index - 1;
+    concurrentStackNode *chunk = atomic_load(&pStack->chunks[pos >> CONCURRENT_STACK_CHUNK_SHIFT]);
+    return &chunk[pos & (CONCURRENT_STACK_CHUNK_SIZE - 1)];
+}
+
+/* 带版本号的链表弹出结点, 空链表返回0 */
+static unsigned int taggedListPop(concurrentStack *pStack, _Atomic unsigned long long *pHead)
+{
+    unsigned long long oldHead = atomic_load(pHead);
+    while (TAGGED_INDEX(oldHead) != 0)
+    {
+        concurrentStackNode *node = getStackNode(pStack, TAGGED_INDEX(oldHead));
+        /* 结点内存不会被释放, 这里读到的 next 即使过期, 下面的 CAS 也会因为版本号不同而失败 */
+        unsigned long long newHead = MAKE_TAGGED(TAGGED_TAG(oldHead) + 1, atomic_load(&node->next));
+        if (atomic_compare_exchange_weak(pHead, &oldHead, newHead))
+        {
+            return TAGGED_INDEX(oldHead);
+        }
+    }
+    return 0;
+}
+
+/* 带版本号的链表压入结点 */
+static void taggedListPush(concurrentStack *pStack, _Atomic unsigned long long *pHead, unsigned int index)
+{
+    concurrentStackNode *node = getStackNode(pStack, index);
+    unsigned long long oldHead = atomic_load(pHead);
+    do
+    {
+        atomic_store(&node->next, TAGGED_INDEX(oldHead));
+    } while (!atomic_compare_exchange_weak(pHead, &oldHead, MAKE_TAGGED(TAGGED_TAG(oldHead) + 1, index)));
+}
+
+/* 申请结点: 优先复用空闲结点, 没有时从结点块里取新的 */
+static unsigned int allocStackNode(concurrentStack *pStack)
+{
+    unsigned int index = taggedListPop(pStack, &pStack->freeHead);
+    if (index != 0)
+    {
+        return index;
+    }
+
+    index = atomic_fetch_add(&pStack->nextIdx, 1);
+    unsigned int chunkIdx = (index - 1) >> CONCURRENT_STACK_CHUNK_SHIFT;
+    if (chunkIdx >= CONCURRENT_STACK_MAX_CHUNKS)
+    {
+        return 0;
+    }
+
+    /* 结点块不存在时申请, 多个线程同时申请时只保留一个 */
+    if (atomic_load(&pStack->chunks[chunkIdx]) == NULL)
+    {
+        concurrentStackNode *chunk = (concurrentStackNode *)calloc(CONCURRENT_STACK_CHUNK_SIZE, sizeof(concurrentStackNode));
+        if (chunk == NULL)
+        {
+            return 0;
+        }
+        concurrentStackNode *expected = NULL;
+        if (!atomic_compare_exchange_strong(&pStack->chunks[chunkIdx], &expected, chunk))
+        {
+            free(chunk);
+        }
+    }
+    return index;
+}
+
+/* 线程私有的随机数, 用来选择消除数组的槽位 */
+static unsigned int eliminationRandom(void)
+{
+    static _Thread_local unsigned int seed = 0;
+    if (seed == 0)
+    {
+        seed = (unsigned int)(unsigned long)&seed | 1;
+    }
+    /* xorshift */
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+/* 栈的初始化 */
+int concurrentStackInit(concurrentStack **pStack)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 成员按缓存行对齐, 需要对齐的内存 */
+    concurrentStack *stack = (concurrentStack *)aligned_alloc(CONCURRENT_STACK_CACHE_LINE, sizeof(concurrentStack));
+    if (stack == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 清空脏数据 */
+    memset(stack, 0, sizeof(concurrentStack));
+
+    atomic_init(&stack->head, 0);
+    atomic_init(&stack->freeHead, 0);
+    /* 下标0表示NULL, 从1开始分配 */
+    atomic_init(&stack->nextIdx, 1);
+    atomic_init(&stack->size, 0);
+    atomic_init(&stack->eliminationSeq, 0);
+    for (int idx = 0; idx < CONCURRENT_STACK_ELIMINATION_SIZE; idx++)
+    {
+        atomic_init(&stack->eliminationSlots[idx], 0);
+    }
+    for (int idx = 0; idx < CONCURRENT_STACK_MAX_CHUNKS; idx++)
+    {
+        atomic_init(&stack->chunks[idx], NULL);
+    }
+
+    *pStack = stack;
+    return ON_SUCCESS;
+}
+
+/* 压栈 (线程安全) */
+int concurrentStackPush(concurrentStack *pStack, ELEMENTTYPE val)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unsigned int index = allocStackNode(pStack);
+    if (index == 0)
+    {
+        return MALLOC_ERROR;
+    }
+    concurrentStackNode *node = getStackNode(pStack, index);
+    atomic_store(&node->data, val);
+    atomic_fetch_add(&pStack->size, 1);
+
+    unsigned long long oldHead = atomic_load(&pStack->head);
+    while (1)
+    {
+        atomic_store(&node->next, TAGGED_INDEX(oldHead));
+        if (atomic_compare_exchange_weak(&pStack->head, &oldHead, MAKE_TAGGED(TAGGED_TAG(oldHead) + 1, index)))
+        {
+            return ON_SUCCESS;
+        }
+
+        /* 竞争失败: 把结点放到消除数组里, 等待出栈者直接取走 */
+        _Atomic unsigned long long *slot = &pStack->eliminationSlots[eliminationRandom() % CONCURRENT_STACK_ELIMINATION_SIZE];
+        /* 序号保证同一个下标再次放入槽位时取值不同 */
+        unsigned long long token = MAKE_TAGGED(atomic_fetch_add(&pStack->eliminationSeq, 1), index);
+        unsigned long long expected = 0;
+        if (atomic_compare_exchange_strong(slot, &expected, token))
+        {
+            for (int spin = 0; spin < ELIMINATION_SPIN_TIMES; spin++)
+            {
+                if (atomic_load(slot) != token)
+                {
+                    /* 已被出栈者取走 */
+                    return ON_SUCCESS;
+                }
+            }
+            /* 没有等到出栈者: 收回结点, 重新竞争栈顶. 收回失败说明刚好被取走了 */
+            expected = token;
+            if (!atomic_compare_exchange_strong(slot, &expected, 0))
+            {
+                return ON_SUCCESS;
+            }
+        }
+        oldHead = atomic_load(&pStack->head);
+    }
+}
+
+/* 出栈并取出栈顶元素 (线程安全, 空栈返回 INVALID_ACCESS) */
+int concurrentStackPop(concurrentStack *pStack, ELEMENTTYPE *pVal)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unsigned int index = 0;
+    unsigned long long oldHead = atomic_load(&pStack->head);
+    while (1)
+    {
+        if (TAGGED_INDEX(oldHead) == 0)
+        {
+            return INVALID_ACCESS;
+        }
+
+        concurrentStackNode *node = getStackNode(pStack, TAGGED_INDEX(oldHead));
+        unsigned long long newHead = MAKE_TAGGED(TAGGED_TAG(oldHead) + 1, atomic_load(&node->next));
+        if (atomic_compare_exchange_weak(&pStack->head, &oldHead, newHead))
+        {
+            index = TAGGED_INDEX(oldHead);
+            break;
+        }
+
+        /* 竞争失败: 尝试从消除数组里直接取一个入栈者的结点 */
+        _Atomic unsigned long long *slot = &pStack->eliminationSlots[eliminationRandom() % CONCURRENT_STACK_ELIMINATION_SIZE];
+        unsigned long long token = atomic_load(slot);
+        if (token != 0 && atomic_compare_exchange_strong(slot, &token, 0))
+        {
+            index = TAGGED_INDEX(token);
+            break;
+        }
+        oldHead = atomic_load(&pStack->head);
+    }
+
+    /* 结点已经归当前线程所有 */
+    concurrentStackNode *node = getStackNode(pStack, index);
+    if (pVal != NULL)
+    {
+        *pVal = atomic_load(&node->data);
+    }
+    atomic_fetch_sub(&pStack->size, 1);
+    /* 回收结点 */
+    taggedListPush(pStack, &pStack->freeHead, index);
+    return ON_SUCCESS;
+}
+
+/* 查看栈顶元素 (只是某一时刻的快照, 多线程下请直接使用 concurrentStackPop 取值) */
+int concurrentStackTop(concurrentStack *pStack, ELEMENTTYPE *pVal)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    unsigned long long head = atomic_load(&pStack->head);
+    if (TAGGED_INDEX(head) == 0)
+    {
+        return INVALID_ACCESS;
+    }
+    if (pVal != NULL)
+    {
+        *pVal = atomic_load(&getStackNode(pStack, TAGGED_INDEX(head))->data);
+    }
+    return ON_SUCCESS;
+}
+
+/* 栈是否为空 */
+int concurrentStackIsEmpty(concurrentStack *pStack)
+{
+    int size = 0;
+    concurrentStackGetSize(pStack, &size);
+    return size == 0 ? 1 : 0;
+}
+
+/* 获取栈的大小 */
+int concurrentStackGetSize(concurrentStack *pStack, int *pSize)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int size = atomic_load(&pStack->size);
+    if (pSize != NULL)
+    {
+        *pSize = size;
+    }
+    return size;
+}
+
+/* 栈的销毁 (调用时不能有其他线程在使用) */
+int concurrentStackDestroy(concurrentStack *pStack)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 结点都在结点块里, 按块释放 */
+    for (int idx = 0; idx < CONCURRENT_STACK_MAX_CHUNKS; idx++)
+    {
+        concurrentStackNode *chunk = atomic_load(&pStack->chunks[idx]);
+        if (chunk != NULL)
+        {
+            free(chunk);
+        }
+    }
+
+    free(pStack);
+    return ON_SUCCESS;
+}
@@ -0,0 +1,69 @@
+#ifndef __CONCURRENT_STACK_H_
+#define __CONCURRENT_STACK_H_
+
+#include "common.h"
+#include <stdatomic.h>
+
+/* 每块结点的个数 (2的幂) */
+#define CONCURRENT_STACK_CHUNK_SHIFT        12
+#define CONCURRENT_STACK_CHUNK_SIZE         (1 << CONCURRENT_STACK_CHUNK_SHIFT)
+/* 结点块的最大个数: 最多容纳 64M 个元素 */
+#define CONCURRENT_STACK_MAX_CHUNKS         16384
+/* 消除数组的槽位个数 */
+#define CONCURRENT_STACK_ELIMINATION_SIZE   16
+/* 缓存行大小 */
+#define CONCURRENT_STACK_CACHE_LINE         64
+
+/* 栈结点: 结点内存只在销毁时释放, 出栈的结点回收到空闲链表里复用 */
+typedef struct concurrentStackNode
+{
+    _Atomic(ELEMENTTYPE) data;
+    /* 下一个结点的下标 (0表示NULL) */
+    _Atomic unsigned int next;
+} concurrentStackNode;
+
+/*
+ * 无锁栈 (Treiber stack).
+ * 栈顶保存为 64 位: 高32位是版本号, 低32位是结点下标.
+ * 每次修改栈顶版本号都加一, 结点被弹出又压回来时 CAS 也会失败, 以此避免 ABA 问题.
+ * CAS 竞争失败时通过消除数组让入栈和出栈直接配对, 不再争抢栈顶.
+ */
+typedef struct concurrentStack
+{
+    /* 栈顶 */
+    _Alignas(CONCURRENT_STACK_CACHE_LINE) _Atomic unsigned long long head;
+    /* 空闲结点链表的头 (同样带版本号) */
+    _Alignas(CONCURRENT_STACK_CACHE_LINE) _Atomic unsigned long long freeHead;
+    /* 下一个没用过的结点下标 */
+    _Alignas(CONCURRENT_STACK_CACHE_LINE) _Atomic unsigned int nextIdx;
+    /* 栈的大小 */
+    _Alignas(CONCURRENT_STACK_CACHE_LINE) _Atomic int size;
+    /* 消除数组: 高32位是序号, 低32位是结点下标, 0表示空槽 */
+    _Alignas(CONCURRENT_STACK_CACHE_LINE) _Atomic unsigned long long eliminationSlots[CONCURRENT_STACK_ELIMINATION_SIZE];
+    _Atomic unsigned int eliminationSeq;
+    /* 结点块 */
+    _Atomic(concurrentStackNode *) chunks[CONCURRENT_STACK_MAX_CHUNKS];
+} concurrentStack;
+
+/* 栈的初始化 */
+int concurrentStackInit(concurrentStack **pStack);
+
+/* 压栈 (线程安全) */
+int concurrentStackPush(concurrentStack *pStack, ELEMENTTYPE val);
+
+/* 出栈并取出栈顶元素 (线程安全, 空栈返回 INVALID_ACCESS) */
+int concurrentStackPop(concurrentStack *pStack, ELEMENTTYPE *pVal);
+
+/* 查看栈顶元素 (只是某一时刻的快照, 多线程下请直接使用 concurrentStackPop 取值) */
+int concurrentStackTop(concurrentStack *pStack, ELEMENTTYPE *pVal);
+
+/* 栈是否为空 */
+int concurrentStackIsEmpty(concurrentStack *pStack);
+
+/* 获取栈的大小 */
+int concurrentStackGetSize(concurrentStack *pStack, int *pSize);
+
+/* 栈的销毁 (调用时不能有其他线程在使用) */
+int concurrentStackDestroy(concurrentStack *pStack);
+
+#endif // __CONCURRENT_STACK_H_
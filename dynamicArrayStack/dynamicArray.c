@@ -2,10 +2,13 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+#include <pthread.h>
 
 /* 状态码 */
 enum STATUS_CODE
 {
+    NOT_FIND = -1,
     ON_SUCCESS,
     NULL_PTR,
     MALLOC_ERROR,
@@ -14,9 +17,45 @@ enum STATUS_CODE
 
 #define DEFAULT_SIZE    10
 
+/* 小于这个长度的区间使用插入排序 */
+#define INSERTION_SORT_THRESHOLD    16
+/* 大于这个长度才使用多线程排序 */
+#define PARALLEL_SORT_THRESHOLD     (1 << 16)
+/* 并行排序最多的线程数 */
+#define PARALLEL_SORT_MAX_THREADS   64
+
 /* 静态函数前置声明 : 静态函数一定要前置声明 */
 static int expandDynamicCapacity(dynamicArray *pArray);
 static int shrinkDynamicCapacity(dynamicArray *pArray);
+static int batchShrinkDynamicCapacity(dynamicArray *pArray);
+static int compactDynamicArray(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int keepMatch, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum);
+static int reserveDynamicCapacity(dynamicArray *pArray, int needCapacity);
+static int resizeDynamicCapacity(dynamicArray *pArray, int newCapacity);
+static int calcGrowthCapacity(dynamicArray *pArray, int capacity);
+static void initDynamicArrayAttr(dynamicArray *pArray, int capacity);
+static int sortedMergeBatch(dynamicArray *pArray, ELEMENTTYPE *vals, int num);
+static void introSortRange(ELEMENTTYPE *data, int begin, int end, int depthLimit, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2));
+static int introSortDepthLimit(int size);
+
+/* 初始化动态数组的参数属性 */
+static void initDynamicArrayAttr(dynamicArray *pArray, int capacity)
+{
+    pArray->len = 0;
+    pArray->capacity = capacity;
+    /* 默认1.5倍扩容 */
+    pArray->growthPolicy = GROWTH_POLICY_1_5;
+    pArray->growthFunc = NULL;
+    /* 默认自动缩容, 容量不低于默认大小 */
+    pArray->shrinkPolicy = SHRINK_POLICY_AUTO;
+    pArray->minCapacity = DEFAULT_SIZE;
+    /* 清空统计计数 */
+    pArray->reallocCount = 0;
+    pArray->copyBytes = 0;
+    /* 默认不是有序模式 */
+    pArray->sortedCompareFunc = NULL;
+    /* 默认没有内部空间 */
+    pArray->inlineData = NULL;
+}
 
 /* 动态数组的初始化 */
 int dynamicArrayInit(dynamicArray *pArray, int capacity)
@@ -38,54 +77,156 @@ int dynamicArrayInit(dynamicArray *pArray, int capacity)
     {
         return MALLOC_ERROR;
     }
-    /* 清除脏数据 */
-    memset(pArray->data, 0, sizeof(ELEMENTTYPE) * capacity);
+    /* 不需要清除脏数据: 只会访问 [0, len) 范围内的元素 */
     /* 初始化动态数组的参数属性 */
-    pArray->len = 0;
-    pArray->capacity = capacity;
+    initDynamicArrayAttr(pArray, capacity);
+
+    return ON_SUCCESS;
+}
+
+/* 带内部空间的动态数组初始化 (元素不超过 DYNAMIC_ARRAY_INLINE_SIZE 时不需要申请堆内存), 之后通过 &pInline->array 使用 */
+int dynamicArrayInitInline(dynamicArrayInline *pInline)
+{
+    if (pInline == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    dynamicArray *pArray = &pInline->array;
+    initDynamicArrayAttr(pArray, DYNAMIC_ARRAY_INLINE_SIZE);
+    pArray->data = pInline->storage;
+    pArray->inlineData = pInline->storage;
 
     return ON_SUCCESS;
 }
 
-/* 动态数组插入数据(默认查到数组的末尾) */
+/* 动态数组插入数据(默认查到数组的末尾, 有序模式下按顺序插入) */
 int dynamicArrayInsertData(dynamicArray *pArray, ELEMENTTYPE val)
 {
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pArray->sortedCompareFunc != NULL)
+    {
+        return dynamicArraySortedInsert(pArray, val, pArray->sortedCompareFunc);
+    }
     return dynamicArrayAppointPosInsertData(pArray, pArray->len, val);
 }
 
 
-/* 动态数组扩容 */
-static int expandDynamicCapacity(dynamicArray *pArray)
+/* 根据扩容策略计算下一次的容量 */
+static int calcGrowthCapacity(dynamicArray *pArray, int capacity)
 {
-    int ret = 0;
-    
-    int needExpandCapacity = pArray->capacity + (pArray->capacity >> 1);
+    long long newCapacity = 0;
+    switch (pArray->growthPolicy)
+    {
+    case GROWTH_POLICY_2:
+        newCapacity = (long long)capacity << 1;
+        break;
+    case GROWTH_POLICY_GOLDEN:
+        /* 黄金分割 1.618 */
+        newCapacity = (long long)capacity * 1618 / 1000;
+        break;
+    case GROWTH_POLICY_CUSTOM:
+        if (pArray->growthFunc != NULL)
+        {
+            newCapacity = pArray->growthFunc(capacity);
+            break;
+        }
+        /* 没有设置自定义函数的时候 按1.5倍处理 */
+        /* fall through */
+    case GROWTH_POLICY_1_5:
+    default:
+        newCapacity = (long long)capacity + (capacity >> 1);
+        break;
+    }
 
-    /* 备份指针 */
-    ELEMENTTYPE * tmpPtr = pArray->data;
-    pArray->data = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * needExpandCapacity);
-    if (pArray->data == NULL)
+    /* 容量至少增长1 (容量为0或者1时乘上因子不会变大) */
+    if (newCapacity <= capacity)
     {
-        return MALLOC_ERROR;
+        newCapacity = (long long)capacity + 1;
+    }
+    /* 避免int溢出 */
+    if (newCapacity > INT_MAX)
+    {
+        newCapacity = INT_MAX;
     }
+    return (int)newCapacity;
+}
 
-    /* 把之前的数据全部拷贝过来 */
-    for (int idx = 0; idx < pArray->len; idx++)
+/* 调整数组容量: 使用realloc原地扩/缩, 并记录统计信息 */
+static int resizeDynamicCapacity(dynamicArray *pArray, int newCapacity)
+{
+    /* realloc(ptr, 0) 的行为不统一, 至少保留一个元素的空间 */
+    if (newCapacity <= 0)
     {
-        pArray->data[idx] = tmpPtr[idx];
+        newCapacity = 1;
     }
 
-    /* 释放以前的内存 避免内存泄漏 */
-    if (tmpPtr != NULL)
+    ELEMENTTYPE * oldPtr = pArray->data;
+    ELEMENTTYPE * newPtr = NULL;
+    if (oldPtr != NULL && oldPtr == pArray->inlineData)
+    {
+        /* 内部空间够用 就不用搬到堆上 */
+        if (newCapacity <= DYNAMIC_ARRAY_INLINE_SIZE)
+        {
+            return ON_SUCCESS;
+        }
+        /* 内部空间不能realloc: 申请堆内存后拷贝过去 */
+        newPtr = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * newCapacity);
+        if (newPtr != NULL)
+        {
+            memcpy(newPtr, oldPtr, sizeof(ELEMENTTYPE) * pArray->len);
+        }
+    }
+    else
+    {
+        newPtr = (ELEMENTTYPE *)realloc(oldPtr, sizeof(ELEMENTTYPE) * newCapacity);
+    }
+    if (newPtr == NULL)
     {
-        free(tmpPtr);
-        tmpPtr = NULL;
+        /* realloc失败时 原来的内存依然有效 */
+        return MALLOC_ERROR;
     }
 
+    /* 统计: 地址变化说明realloc搬移了数据 */
+    (pArray->reallocCount)++;
+    if (newPtr != oldPtr)
+    {
+        pArray->copyBytes += (long long)sizeof(ELEMENTTYPE) * pArray->len;
+    }
+
+    pArray->data = newPtr;
     /* 更新动态数组的容量 */
-    pArray->capacity = needExpandCapacity;
+    pArray->capacity = newCapacity;
+
+    return ON_SUCCESS;
+}
+
+/* 动态数组扩容 */
+static int expandDynamicCapacity(dynamicArray *pArray)
+{
+    return resizeDynamicCapacity(pArray, calcGrowthCapacity(pArray, pArray->capacity));
+}
+
+/* 按需一次性扩容到至少 needCapacity, 避免批量插入时多次扩容 */
+static int reserveDynamicCapacity(dynamicArray *pArray, int needCapacity)
+{
+    if (needCapacity <= pArray->capacity)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 按扩容策略递增, 直到容量足够 */
+    int newCapacity = pArray->capacity;
+    while (newCapacity < needCapacity)
+    {
+        newCapacity = calcGrowthCapacity(pArray, newCapacity);
+    }
 
-    return ret;
+    return resizeDynamicCapacity(pArray, newCapacity);
 }
 
 /* 动态数组插入数据, 在指定位置插入 */
@@ -97,13 +238,13 @@ int dynamicArrayAppointPosInsertData(dynamicArray *pArray, int pos, ELEMENTTYPE
         return NULL_PTR;
     }
 
-    /* 判断位置的合法性 */
-    if (pos < 0 || pos > pArray->len)
+    /* 判断位置的合法性 (有序模式下不能指定位置插入) */
+    if (pos < 0 || pos > pArray->len || pArray->sortedCompareFunc != NULL)
     {
         return INVALID_ACCESS;
     }
     
-    #if 1
+    #if 0
     /* 数组扩容的临界值是: 数组大小的1.5倍 >= 数组容量 */
     if ((pArray->len + (pArray->len >> 1)) >= pArray->capacity)
     {
@@ -111,10 +252,15 @@ int dynamicArrayAppointPosInsertData(dynamicArray *pArray, int pos, ELEMENTTYPE
         expandDynamicCapacity(pArray);
     }
     #else
+    /* 数组满了才扩容, 避免浪费内存 */
     if (pArray->len == pArray->capacity)
     {
         /* 开始扩容 */
-        expandDynamicCapacity(pArray);
+        int ret = expandDynamicCapacity(pArray);
+        if (ret != ON_SUCCESS)
+        {
+            return ret;
+        }
     }
     #endif
    
@@ -139,6 +285,113 @@ int dynamicArrayAppointPosInsertData(dynamicArray *pArray, int pos, ELEMENTTYPE
 }
 
 
+/* 动态数组批量插入数据, 在指定位置插入 num 个元素 */
+int dynamicArrayInsertRange(dynamicArray *pArray, int pos, ELEMENTTYPE *vals, int num)
+{
+    /* 指针判空 */
+    if (pArray == NULL || (vals == NULL && num > 0))
+    {
+        return NULL_PTR;
+    }
+
+    /* 判断位置和数量的合法性 (有序模式下不能指定位置插入) */
+    if (pos < 0 || pos > pArray->len || num < 0 || pArray->sortedCompareFunc != NULL)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (num == 0)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 只扩容一次 */
+    int ret = reserveDynamicCapacity(pArray, pArray->len + num);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+
+    /* 尾部数据整体后移 num 个位置 */
+    memmove(pArray->data + pos + num, pArray->data + pos, sizeof(ELEMENTTYPE) * (pArray->len - pos));
+    /* 一次性拷贝插入的数据 */
+    memcpy(pArray->data + pos, vals, sizeof(ELEMENTTYPE) * num);
+    /* 更新数组的大小 */
+    pArray->len += num;
+
+    return ON_SUCCESS;
+}
+
+/* 动态数组批量插入数据(默认插到数组的末尾, 有序模式下排序后归并, O(n + k log k)) */
+int dynamicArrayAppendBatch(dynamicArray *pArray, ELEMENTTYPE *vals, int num)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pArray->sortedCompareFunc != NULL)
+    {
+        if (vals == NULL && num > 0)
+        {
+            return NULL_PTR;
+        }
+        if (num < 0)
+        {
+            return INVALID_ACCESS;
+        }
+        return sortedMergeBatch(pArray, vals, num);
+    }
+    return dynamicArrayInsertRange(pArray, pArray->len, vals, num);
+}
+
+/* 有序模式的批量插入: 新元素先排好序, 再和原数组从后往前归并, O(n + k log k) */
+static int sortedMergeBatch(dynamicArray *pArray, ELEMENTTYPE *vals, int num)
+{
+    if (num == 0)
+    {
+        return ON_SUCCESS;
+    }
+
+    ELEMENTTYPE *sortedVals = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * num);
+    if (sortedVals == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    /* 只扩容一次 */
+    int ret = reserveDynamicCapacity(pArray, pArray->len + num);
+    if (ret != ON_SUCCESS)
+    {
+        free(sortedVals);
+        return ret;
+    }
+
+    int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2) = pArray->sortedCompareFunc;
+    memcpy(sortedVals, vals, sizeof(ELEMENTTYPE) * num);
+    introSortRange(sortedVals, 0, num, introSortDepthLimit(num), compareFunc);
+
+    /* 从后往前归并, 写的位置不会覆盖还没读的原有元素 */
+    int oldIdx = pArray->len - 1;
+    int newIdx = num - 1;
+    int writeIdx = pArray->len + num - 1;
+    while (newIdx >= 0)
+    {
+        /* 相等时新元素放在后面, 和 dynamicArraySortedInsert 一致 */
+        if (oldIdx >= 0 && compareFunc(pArray->data[oldIdx], sortedVals[newIdx]) > 0)
+        {
+            pArray->data[writeIdx--] = pArray->data[oldIdx--];
+        }
+        else
+        {
+            pArray->data[writeIdx--] = sortedVals[newIdx--];
+        }
+    }
+    pArray->len += num;
+
+    free(sortedVals);
+    return ON_SUCCESS;
+}
+
 /* 动态数组修改指定位置的数据 */
 int dynamicArrayModifyAppointPosData(dynamicArray *pArray, int pos, ELEMENTTYPE val)
 {
@@ -148,8 +401,8 @@ int dynamicArrayModifyAppointPosData(dynamicArray *pArray, int pos, ELEMENTTYPE
         return NULL_PTR;
     }
 
-    /* 判断位置的合法性 */
-    if (pos < 0 || pos >= pArray->len)
+    /* 判断位置的合法性 (有序模式下修改会破坏顺序) */
+    if (pos < 0 || pos >= pArray->len || pArray->sortedCompareFunc != NULL)
     {
         return INVALID_ACCESS;
     }
@@ -163,36 +416,62 @@ int dynamicArrayModifyAppointPosData(dynamicArray *pArray, int pos, ELEMENTTYPE
 /* 动态数组删除数据(默认情况下删除最后末尾的数据) */
 int dynamicArrayDeleteData(dynamicArray *pArray)
 {
-    dynamicArrayDeleteAppointPosData(pArray, pArray->len - 1);
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+    return dynamicArrayDeleteAppointPosData(pArray, pArray->len - 1);
 }
 
 
+/* 动态数组缩容: 带滞回区间, 避免在边界上反复扩/缩容 */
 static int shrinkDynamicCapacity(dynamicArray *pArray)
 {
+    /* 关闭了自动缩容 */
+    if (pArray->shrinkPolicy == SHRINK_POLICY_NONE)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 低水位: 大小低于容量的1/4才缩容 */
+    if (pArray->len >= (pArray->capacity >> 2) || pArray->capacity <= pArray->minCapacity)
+    {
+        return ON_SUCCESS;
+    }
+
+    /* 缩到容量的一半, 缩容之后使用率约为1/2, 离扩/缩容的边界都足够远 */
     int needShrinkCapacity = pArray->capacity - (pArray->capacity >> 1);
+    if (needShrinkCapacity < pArray->minCapacity)
+    {
+        needShrinkCapacity = pArray->minCapacity;
+    }
+    return resizeDynamicCapacity(pArray, needShrinkCapacity);
+}
 
-    ELEMENTTYPE * tmpPtr = pArray->data;
-    pArray->data = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * needShrinkCapacity);
-    if (pArray->data == NULL)
+/* 批量删除之后缩容: 一次算好最终容量, 只realloc一次 */
+static int batchShrinkDynamicCapacity(dynamicArray *pArray)
+{
+    if (pArray->shrinkPolicy == SHRINK_POLICY_NONE)
     {
-        return MALLOC_ERROR;
+        return ON_SUCCESS;
     }
 
-    /* 拷贝之前的数据到新的空间 */
-    for (int idx = 0; idx < pArray->len; idx++)
+    /* 按照逐个删除时的规则推算最终容量 */
+    int needShrinkCapacity = pArray->capacity;
+    while (pArray->len < (needShrinkCapacity >> 2) && needShrinkCapacity > pArray->minCapacity)
     {
-        pArray->data[idx] = tmpPtr[idx];
+        needShrinkCapacity = needShrinkCapacity - (needShrinkCapacity >> 1);
+        if (needShrinkCapacity < pArray->minCapacity)
+        {
+            needShrinkCapacity = pArray->minCapacity;
+        }
     }
-    
-    /* 释放内存空间 避免内存泄漏 */
-    if (tmpPtr != NULL)
+
+    if (needShrinkCapacity == pArray->capacity)
     {
-        free(tmpPtr);
-        tmpPtr = NULL;
+        return ON_SUCCESS;
     }
-    /* 更新容量 */
-    pArray->capacity = needShrinkCapacity;
-    return ON_SUCCESS;
+    return resizeDynamicCapacity(pArray, needShrinkCapacity);
 }
 
 /* 动态数组删除指定位置数据 */
@@ -208,12 +487,6 @@ int dynamicArrayDeleteAppointPosData(dynamicArray *pArray, int pos)
         return INVALID_ACCESS;
     }
 
-    /* 缩容 */
-    if (pArray->len < pArray->capacity >> 1)
-    {
-        shrinkDynamicCapacity(pArray);
-    }   
-
     /* 数据前移 */
     /* 删除指定位置的时候, 遍历最后的位置是len - 1. */
     for (int idx = pos; idx < (pArray->len - 1); idx++)
@@ -222,13 +495,19 @@ int dynamicArrayDeleteAppointPosData(dynamicArray *pArray, int pos)
     }
     /* 更新数组的大小 */
     (pArray->len)--;
+
+    /* 缩容 (删除之后再判断, 缩容失败不影响删除结果) */
+    shrinkDynamicCapacity(pArray);
     return ON_SUCCESS;
 }
 
-/* 动态数组删除指定的元素 */
+/* 动态数组删除指定的元素 (compareFunc 和排序/二分查找相同, 返回0表示相等) */
 int dynamicArrayDeleteAppointData(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
 {
-    /* todo... */
+    if (pArray == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
 #if 0
     int idx = 0;
     for (idx; idx < pArray->len; idx++)
@@ -240,7 +519,7 @@ int dynamicArrayDeleteAppointData(dynamicArray *pArray, ELEMENTTYPE val, int (*c
             idx = 0;
         }
     }
-#else   
+#elif 0
     for (int idx = pArray->len - 1; idx >= 0; idx--)
     {
         #if 0
@@ -256,10 +535,97 @@ int dynamicArrayDeleteAppointData(dynamicArray *pArray, ELEMENTTYPE val, int (*c
         }
         #endif
     }
+#else
+    /* 读写双指针一次遍历: 不匹配的元素前移到写指针的位置 */
+    int writeIdx = 0;
+    for (int readIdx = 0; readIdx < pArray->len; readIdx++)
+    {
+        if (compareFunc(val, pArray->data[readIdx]) != 0)
+        {
+            pArray->data[writeIdx++] = pArray->data[readIdx];
+        }
+    }
+    pArray->len = writeIdx;
+
+    /* 全部删除之后再统一缩容 */
+    batchShrinkDynamicCapacity(pArray);
 #endif
     return ON_SUCCESS;
 }
 
+/* 动态数组截断: 只保留前 len 个元素 (len 为0时清空数组) */
+int dynamicArrayTruncate(dynamicArray *pArray, int len)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (len < 0 || len > pArray->len)
+    {
+        return INVALID_ACCESS;
+    }
+
+    pArray->len = len;
+    /* 一次算好缩容后的容量 */
+    batchShrinkDynamicCapacity(pArray);
+    return ON_SUCCESS;
+}
+
+/* 按条件压缩数组: keepMatch为0时删除满足条件的元素, 为1时保留满足条件的元素 */
+static int compactDynamicArray(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int keepMatch, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum)
+{
+    if (pArray == NULL || predicate == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 读写双指针一次遍历 */
+    int writeIdx = 0;
+    for (int readIdx = 0; readIdx < pArray->len; readIdx++)
+    {
+        int match = predicate(pArray->data[readIdx], ctx) ? 1 : 0;
+        if (match == keepMatch)
+        {
+            /* 保留 */
+            pArray->data[writeIdx++] = pArray->data[readIdx];
+        }
+        else if (destroyFunc != NULL)
+        {
+            /* 删除的元素交给调用者释放 */
+            destroyFunc(pArray->data[readIdx]);
+        }
+    }
+
+    if (pRemoveNum != NULL)
+    {
+        *pRemoveNum = pArray->len - writeIdx;
+    }
+    pArray->len = writeIdx;
+
+    /* 全部删除之后再统一缩容 */
+    batchShrinkDynamicCapacity(pArray);
+    return ON_SUCCESS;
+}
+
+/* 动态数组删除满足条件的元素 */
+int dynamicArrayRemoveIf(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int *pRemoveNum)
+{
+    return compactDynamicArray(pArray, predicate, ctx, 0, NULL, pRemoveNum);
+}
+
+/* 动态数组删除满足条件的元素, 被删除的元素交给 destroyFunc 释放 */
+int dynamicArrayRemoveIfWithDestroy(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int (*destroyFunc)(ELEMENTTYPE val), int *pRemoveNum)
+{
+    return compactDynamicArray(pArray, predicate, ctx, 0, destroyFunc, pRemoveNum);
+}
+
+/* 动态数组只保留满足条件的元素 */
+int dynamicArrayRetainIf(dynamicArray *pArray, int (*predicate)(ELEMENTTYPE val, void *ctx), void *ctx, int *pRemoveNum)
+{
+    return compactDynamicArray(pArray, predicate, ctx, 1, NULL, pRemoveNum);
+}
+
 /* 动态数组的销毁 */
 int dynamicArrayDestroy(dynamicArray *pArray)
 {
@@ -268,11 +634,12 @@ int dynamicArrayDestroy(dynamicArray *pArray)
         return NULL_PTR;
     }
 
-    if (pArray->data != NULL)
+    /* 内部空间不需要释放 */
+    if (pArray->data != NULL && pArray->data != pArray->inlineData)
     {
         free(pArray->data);
-        pArray->data = NULL;
     }
+    pArray->data = NULL;
     return ON_SUCCESS;
 }
 
@@ -307,6 +674,97 @@ int dynamicArrayGetCapacity(dynamicArray *pArray, int *pCapacity)
     return ON_SUCCESS;
 }
 
+/* 设置扩容策略 (growthFunc 只在 GROWTH_POLICY_CUSTOM 时生效) */
+int dynamicArraySetGrowthPolicy(dynamicArray *pArray, int policy, int (*growthFunc)(int capacity))
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (policy < GROWTH_POLICY_1_5 || policy > GROWTH_POLICY_CUSTOM)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (policy == GROWTH_POLICY_CUSTOM && growthFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    pArray->growthPolicy = policy;
+    pArray->growthFunc = growthFunc;
+    return ON_SUCCESS;
+}
+
+/* 设置缩容策略: 是否自动缩容, 以及缩容的最小容量 */
+int dynamicArraySetShrinkPolicy(dynamicArray *pArray, int policy, int minCapacity)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if ((policy != SHRINK_POLICY_AUTO && policy != SHRINK_POLICY_NONE) || minCapacity < 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    pArray->shrinkPolicy = policy;
+    pArray->minCapacity = minCapacity;
+    return ON_SUCCESS;
+}
+
+/* 预留容量: 容量至少为 capacity */
+int dynamicArrayReserve(dynamicArray *pArray, int capacity)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (capacity <= pArray->capacity)
+    {
+        return ON_SUCCESS;
+    }
+    /* 精确分配到需要的容量 */
+    return resizeDynamicCapacity(pArray, capacity);
+}
+
+/* 释放多余的容量: 容量缩到和大小一致 */
+int dynamicArrayShrinkToFit(dynamicArray *pArray)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pArray->capacity == pArray->len)
+    {
+        return ON_SUCCESS;
+    }
+    return resizeDynamicCapacity(pArray, pArray->len);
+}
+
+/* 获取扩/缩容的统计信息 */
+int dynamicArrayGetGrowthStats(dynamicArray *pArray, int *pReallocCount, long long *pCopyBytes)
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pReallocCount != NULL)
+    {
+        *pReallocCount = pArray->reallocCount;
+    }
+    if (pCopyBytes != NULL)
+    {
+        *pCopyBytes = pArray->copyBytes;
+    }
+    return ON_SUCCESS;
+}
+
 /* 获取指定位置的元素数据 */
 int dynamicArrayGetAppointPosVal(dynamicArray *pArray, int pos, ELEMENTTYPE *pVal)
 {
@@ -328,10 +786,547 @@ int dynamicArrayGetAppointPosVal(dynamicArray *pArray, int pos, ELEMENTTYPE *pVa
     return ON_SUCCESS;
 }
 
-/* 数组排序 */
+/* 小区间插入排序 [begin, end) */
+static void insertionSortRange(ELEMENTTYPE *data, int begin, int end, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    for (int idx = begin + 1; idx < end; idx++)
+    {
+        ELEMENTTYPE val = data[idx];
+        int pos = idx;
+        /* 严格大于才后移, 相等元素保持原来的顺序 */
+        while (pos > begin && compareFunc(data[pos - 1], val) > 0)
+        {
+            data[pos] = data[pos - 1];
+            pos--;
+        }
+        data[pos] = val;
+    }
+}
+
+/* 堆的下沉 (大顶堆), 堆的区间从 base 开始, 大小为 size */
+static void heapSiftDown(ELEMENTTYPE *base, int idx, int size, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    ELEMENTTYPE val = base[idx];
+    int child = 0;
+    while ((child = (idx << 1) + 1) < size)
+    {
+        /* 选出较大的孩子 */
+        if (child + 1 < size && compareFunc(base[child + 1], base[child]) > 0)
+        {
+            child++;
+        }
+        if (compareFunc(base[child], val) <= 0)
+        {
+            break;
+        }
+        base[idx] = base[child];
+        idx = child;
+    }
+    base[idx] = val;
+}
+
+/* 堆排序 [begin, end): 快排递归过深时的兜底, 保证最坏 O(nlogn) */
+static void heapSortRange(ELEMENTTYPE *data, int begin, int end, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    ELEMENTTYPE *base = data + begin;
+    int size = end - begin;
+
+    /* 建堆 */
+    for (int idx = (size >> 1) - 1; idx >= 0; idx--)
+    {
+        heapSiftDown(base, idx, size, compareFunc);
+    }
+    /* 依次把堆顶换到末尾 */
+    for (int last = size - 1; last > 0; last--)
+    {
+        ELEMENTTYPE tmp = base[0];
+        base[0] = base[last];
+        base[last] = tmp;
+        heapSiftDown(base, 0, last, compareFunc);
+    }
+}
+
+/* 三数取中, 返回中间值的下标 */
+static int medianOfThree(ELEMENTTYPE *data, int a, int b, int c, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    if (compareFunc(data[a], data[b]) < 0)
+    {
+        if (compareFunc(data[b], data[c]) < 0)
+        {
+            return b;
+        }
+        return compareFunc(data[a], data[c]) < 0 ? c : a;
+    }
+    if (compareFunc(data[a], data[c]) < 0)
+    {
+        return a;
+    }
+    return compareFunc(data[b], data[c]) < 0 ? c : b;
+}
+
+/* 内省排序 [begin, end): 快排 + 小区间插入排序 + 递归过深改用堆排序 */
+static void introSortRange(ELEMENTTYPE *data, int begin, int end, int depthLimit, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    while (end - begin > INSERTION_SORT_THRESHOLD)
+    {
+        if (depthLimit == 0)
+        {
+            heapSortRange(data, begin, end, compareFunc);
+            return;
+        }
+        depthLimit--;
+
+        /* 三数取中作为基准, 放到区间开头 */
+        int mid = begin + ((end - begin) >> 1);
+        int pivotIdx = medianOfThree(data, begin, mid, end - 1, compareFunc);
+        ELEMENTTYPE pivot = data[pivotIdx];
+        data[pivotIdx] = data[begin];
+        data[begin] = pivot;
+
+        /* Hoare 划分: 与基准相等的元素分散到两边, 重复元素多时也不会退化 */
+        int left = begin;
+        int right = end;
+        while (1)
+        {
+            do
+            {
+                left++;
+            } while (left < end && compareFunc(data[left], pivot) < 0);
+            do
+            {
+                right--;
+            } while (compareFunc(data[right], pivot) > 0);
+
+            if (left >= right)
+            {
+                break;
+            }
+            ELEMENTTYPE tmp = data[left];
+            data[left] = data[right];
+            data[right] = tmp;
+        }
+        /* 基准归位 */
+        data[begin] = data[right];
+        data[right] = pivot;
+
+        /* 递归处理较小的一半, 较大的一半继续循环, 栈深度为 O(logn) */
+        if (right - begin < end - right - 1)
+        {
+            introSortRange(data, begin, right, depthLimit, compareFunc);
+            begin = right + 1;
+        }
+        else
+        {
+            introSortRange(data, right + 1, end, depthLimit, compareFunc);
+            end = right;
+        }
+    }
+    insertionSortRange(data, begin, end, compareFunc);
+}
+
+/* 计算内省排序允许的递归深度: 2 * log2(n) */
+static int introSortDepthLimit(int size)
+{
+    int depth = 0;
+    while (size > 1)
+    {
+        size >>= 1;
+        depth++;
+    }
+    return depth << 1;
+}
+
+/* 数组排序 (compareFunc 返回值 <0, 0, >0 分别表示 val1 小于, 等于, 大于 val2) */
 int dynamicArrayAppointWaySort(dynamicArray *pArray, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
 {
-    int ret = 0;
+    if (pArray == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pArray->len > 1)
+    {
+        introSortRange(pArray->data, 0, pArray->len, introSortDepthLimit(pArray->len), compareFunc);
+    }
+    return ON_SUCCESS;
+}
+
+/* 并行排序: 每个线程负责的分段 */
+typedef struct parallelSortTask
+{
+    ELEMENTTYPE *src;       /* 源数据 */
+    ELEMENTTYPE *dst;       /* 归并的目标 */
+    int begin;              /* 第一段起点 */
+    int mid;                /* 第二段起点 */
+    int end;                /* 第二段终点 */
+    int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2);
+} parallelSortTask;
+
+/* 线程函数: 对分段进行内省排序 */
+static void * parallelSortChunkRoutine(void *arg)
+{
+    parallelSortTask *task = (parallelSortTask *)arg;
+    introSortRange(task->src, task->begin, task->end, introSortDepthLimit(task->end - task->begin), task->compareFunc);
+    return NULL;
+}
+
+/* 线程函数: 把两段有序区间 [begin, mid) [mid, end) 归并到 dst */
+static void * parallelSortMergeRoutine(void *arg)
+{
+    parallelSortTask *task = (parallelSortTask *)arg;
+    ELEMENTTYPE *src = task->src;
+    ELEMENTTYPE *dst = task->dst;
+    int left = task->begin;
+    int right = task->mid;
+    int pos = task->begin;
+
+    while (left < task->mid && right < task->end)
+    {
+        /* 右边严格小于才取右边, 保证相等元素的先后顺序 */
+        if (task->compareFunc(src[right], src[left]) < 0)
+        {
+            dst[pos++] = src[right++];
+        }
+        else
+        {
+            dst[pos++] = src[left++];
+        }
+    }
+    memcpy(dst + pos, src + left, sizeof(ELEMENTTYPE) * (task->mid - left));
+    pos += task->mid - left;
+    memcpy(dst + pos, src + right, sizeof(ELEMENTTYPE) * (task->end - right));
+    return NULL;
+}
+
+/* 数组并行排序: 分段由多个线程各自排序, 再逐轮两两并行归并 */
+int dynamicArrayParallelSort(dynamicArray *pArray, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int threadNum)
+{
+    if (pArray == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
 
-    return ret;
-}
\ No newline at end of file
+    if (threadNum > PARALLEL_SORT_MAX_THREADS)
+    {
+        threadNum = PARALLEL_SORT_MAX_THREADS;
+    }
+    /* 数据量不大时 线程开销比收益大, 直接单线程排序 */
+    if (threadNum <= 1 || pArray->len < PARALLEL_SORT_THRESHOLD)
+    {
+        return dynamicArrayAppointWaySort(pArray, compareFunc);
+    }
+
+    ELEMENTTYPE *tmpBuffer = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * pArray->len);
+    if (tmpBuffer == NULL)
+    {
+        /* 申请不到辅助空间 退化为单线程排序 */
+        return dynamicArrayAppointWaySort(pArray, compareFunc);
+    }
+
+    /* 分段边界 */
+    int bounds[PARALLEL_SORT_MAX_THREADS + 1];
+    for (int idx = 0; idx <= threadNum; idx++)
+    {
+        bounds[idx] = (int)((long long)pArray->len * idx / threadNum);
+    }
+
+    pthread_t tids[PARALLEL_SORT_MAX_THREADS];
+    int created[PARALLEL_SORT_MAX_THREADS];
+    parallelSortTask tasks[PARALLEL_SORT_MAX_THREADS];
+
+    /* 第一步: 各个分段并行排序 (线程创建失败就在当前线程里排) */
+    for (int idx = 0; idx < threadNum; idx++)
+    {
+        tasks[idx].src = pArray->data;
+        tasks[idx].dst = NULL;
+        tasks[idx].begin = bounds[idx];
+        tasks[idx].mid = bounds[idx + 1];
+        tasks[idx].end = bounds[idx + 1];
+        tasks[idx].compareFunc = compareFunc;
+        created[idx] = pthread_create(&tids[idx], NULL, parallelSortChunkRoutine, &tasks[idx]) == 0;
+        if (!created[idx])
+        {
+            parallelSortChunkRoutine(&tasks[idx]);
+        }
+    }
+    for (int idx = 0; idx < threadNum; idx++)
+    {
+        if (created[idx])
+        {
+            pthread_join(tids[idx], NULL);
+        }
+    }
+
+    /* 第二步: 两两归并, 每轮分段数减半, 源和目标缓冲区交替使用 */
+    ELEMENTTYPE *src = pArray->data;
+    ELEMENTTYPE *dst = tmpBuffer;
+    int chunkNum = threadNum;
+    while (chunkNum > 1)
+    {
+        int taskNum = 0;
+        int newChunkNum = 0;
+        for (int idx = 0; idx < chunkNum; idx += 2)
+        {
+            tasks[taskNum].src = src;
+            tasks[taskNum].dst = dst;
+            tasks[taskNum].begin = bounds[idx];
+            /* 落单的最后一段直接拷贝过去 */
+            tasks[taskNum].mid = idx + 1 < chunkNum ? bounds[idx + 1] : bounds[chunkNum];
+            tasks[taskNum].end = idx + 1 < chunkNum ? bounds[idx + 2] : bounds[chunkNum];
+            tasks[taskNum].compareFunc = compareFunc;
+            created[taskNum] = pthread_create(&tids[taskNum], NULL, parallelSortMergeRoutine, &tasks[taskNum]) == 0;
+            if (!created[taskNum])
+            {
+                parallelSortMergeRoutine(&tasks[taskNum]);
+            }
+            bounds[newChunkNum++] = bounds[idx];
+            taskNum++;
+        }
+        for (int idx = 0; idx < taskNum; idx++)
+        {
+            if (created[idx])
+            {
+                pthread_join(tids[idx], NULL);
+            }
+        }
+        bounds[newChunkNum] = pArray->len;
+        chunkNum = newChunkNum;
+
+        /* 交换源和目标 */
+        ELEMENTTYPE *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    /* 结果最终落在辅助空间时 拷贝回数组 */
+    if (src != pArray->data)
+    {
+        memcpy(pArray->data, src, sizeof(ELEMENTTYPE) * pArray->len);
+    }
+
+    free(tmpBuffer);
+    tmpBuffer = NULL;
+    return ON_SUCCESS;
+}
+
+/* 有序数组二分: 无分支的写法, 循环里只有一次比较和一次条件赋值, 避免分支预测失败.
+ * upper 为0时求第一个 >= val 的位置, 为1时求第一个 > val 的位置 */
+static int sortedArrayBound(ELEMENTTYPE *data, int len, ELEMENTTYPE val, int upper, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    int base = 0;
+    int num = len;
+    while (num > 1)
+    {
+        int half = num >> 1;
+        int cmp = compareFunc(data[base + half], val);
+        /* 编译器会生成 cmov */
+        base = (upper ? cmp <= 0 : cmp < 0) ? base + half : base;
+        num -= half;
+    }
+    int cmp = compareFunc(data[base], val);
+    return base + (upper ? cmp <= 0 : cmp < 0);
+}
+
+/* 有序数组: 第一个大于等于 val 的位置 (都小于 val 时为 len) */
+int dynamicArrayLowerBound(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pPos)
+{
+    if (pArray == NULL || compareFunc == NULL || pPos == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    *pPos = sortedArrayBound(pArray->data, pArray->len, val, 0, compareFunc);
+    return ON_SUCCESS;
+}
+
+/* 有序数组: 第一个大于 val 的位置 (都小于等于 val 时为 len) */
+int dynamicArrayUpperBound(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pPos)
+{
+    if (pArray == NULL || compareFunc == NULL || pPos == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    *pPos = sortedArrayBound(pArray->data, pArray->len, val, 1, compareFunc);
+    return ON_SUCCESS;
+}
+
+/* 有序数组: 等于 val 的区间 [*pBegin, *pEnd) */
+int dynamicArrayEqualRange(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pBegin, int *pEnd)
+{
+    if (pArray == NULL || compareFunc == NULL || pBegin == NULL || pEnd == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    *pBegin = sortedArrayBound(pArray->data, pArray->len, val, 0, compareFunc);
+    /* 上界只需要在下界之后查找 */
+    *pEnd = *pBegin + sortedArrayBound(pArray->data + *pBegin, pArray->len - *pBegin, val, 1, compareFunc);
+    return ON_SUCCESS;
+}
+
+/* 有序数组: 二分查找 val, 找不到时 *pPos 为 NOT_FIND 并返回 NOT_FIND */
+int dynamicArrayBinarySearch(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), int *pPos)
+{
+    if (pArray == NULL || compareFunc == NULL || pPos == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int pos = sortedArrayBound(pArray->data, pArray->len, val, 0, compareFunc);
+    if (pos < pArray->len && compareFunc(pArray->data[pos], val) == 0)
+    {
+        *pPos = pos;
+        return ON_SUCCESS;
+    }
+    *pPos = NOT_FIND;
+    return NOT_FIND;
+}
+
+/* 有序数组: 按顺序插入 (插在相等元素的后面, 保持插入顺序) */
+int dynamicArraySortedInsert(dynamicArray *pArray, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    if (pArray == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int pos = sortedArrayBound(pArray->data, pArray->len, val, 1, compareFunc);
+
+    /* 不走指定位置插入的接口: 有序模式下那些接口会拒绝插入 */
+    int ret = reserveDynamicCapacity(pArray, pArray->len + 1);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+    memmove(pArray->data + pos + 1, pArray->data + pos, sizeof(ELEMENTTYPE) * (pArray->len - pos));
+    pArray->data[pos] = val;
+    (pArray->len)++;
+
+    return ON_SUCCESS;
+}
+
+/* 设置有序模式: compareFunc 不为NULL时先把已有元素排好序, 之后插入都保持有序; 为NULL时关闭 */
+int dynamicArraySetSortedMode(dynamicArray *pArray, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2))
+{
+    if (pArray == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (compareFunc != NULL && pArray->len > 1)
+    {
+        dynamicArrayAppointWaySort(pArray, compareFunc);
+    }
+    pArray->sortedCompareFunc = compareFunc;
+
+    return ON_SUCCESS;
+}
+
+/* 按中序把有序数组填到 Eytzinger 布局 (下标从1开始, k 的孩子是 2k 和 2k+1) */
+static int eytzingerFill(ELEMENTTYPE *dst, int len, ELEMENTTYPE *src, int srcIdx, int k)
+{
+    if (k <= len)
+    {
+        srcIdx = eytzingerFill(dst, len, src, srcIdx, k << 1);
+        dst[k] = src[srcIdx++];
+        srcIdx = eytzingerFill(dst, len, src, srcIdx, (k << 1) + 1);
+    }
+    return srcIdx;
+}
+
+/* 用有序数组构建 Eytzinger 布局的查找表 (适合只读的静态表) */
+int dynamicArrayEytzingerBuild(dynamicArray *pArray, dynamicArrayEytzinger *pEytz)
+{
+    if (pArray == NULL || pEytz == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 下标0不用 */
+    pEytz->data = (ELEMENTTYPE *)malloc(sizeof(ELEMENTTYPE) * (pArray->len + 1));
+    if (pEytz->data == NULL)
+    {
+        return MALLOC_ERROR;
+    }
+    pEytz->data[0] = NULL;
+    pEytz->len = pArray->len;
+    eytzingerFill(pEytz->data, pEytz->len, pArray->data, 0, 1);
+
+    return ON_SUCCESS;
+}
+
+/* Eytzinger 查找表: 第一个大于等于 val 的元素, 不存在时返回 NOT_FIND */
+int dynamicArrayEytzingerLowerBound(dynamicArrayEytzinger *pEytz, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), ELEMENTTYPE *pVal)
+{
+    if (pEytz == NULL || compareFunc == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    int k = 1;
+    while (k <= pEytz->len)
+    {
+        /* 提前预取几层之后的结点, 它们在内存里是连续的 (越界的地址不计算) */
+        if ((k << 4) <= pEytz->len)
+        {
+            __builtin_prefetch(pEytz->data + (k << 4));
+        }
+        k = (k << 1) + (compareFunc(pEytz->data[k], val) < 0);
+    }
+    /* 去掉最后一段向右走的路径, 回到最后一次向左走的结点 */
+    k >>= __builtin_ffs(~k);
+    if (k == 0)
+    {
+        return NOT_FIND;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = pEytz->data[k];
+    }
+    return ON_SUCCESS;
+}
+
+/* Eytzinger 查找表: 查找等于 val 的元素, 不存在时返回 NOT_FIND */
+int dynamicArrayEytzingerSearch(dynamicArrayEytzinger *pEytz, ELEMENTTYPE val, int (*compareFunc)(ELEMENTTYPE val1, ELEMENTTYPE val2), ELEMENTTYPE *pVal)
+{
+    ELEMENTTYPE found = NULL;
+    int ret = dynamicArrayEytzingerLowerBound(pEytz, val, compareFunc, &found);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+
+    if (compareFunc(found, val) != 0)
+    {
+        return NOT_FIND;
+    }
+    if (pVal != NULL)
+    {
+        *pVal = found;
+    }
+    return ON_SUCCESS;
+}
+
+/* Eytzinger 查找表的销毁 */
+int dynamicArrayEytzingerDestroy(dynamicArrayEytzinger *pEytz)
+{
+    if (pEytz == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pEytz->data != NULL)
+    {
+        free(pEytz->data);
+        pEytz->data = NULL;
+    }
+    pEytz->len = 0;
+    return ON_SUCCESS;
+}
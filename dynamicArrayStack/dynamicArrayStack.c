@@ -1,7 +1,17 @@
 #include "dynamicArrayStack.h"
 #include "dynamicArray.h"
+#include <string.h>
 #define DEFAULT_SIZE    10
 
+/* 状态码 */
+enum STATUS_CODE
+{
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
 /* 栈的初始化 */
 int dynamicArrayStackInit(dynamicArrayStack *pStack)
 {
@@ -28,6 +38,50 @@ int dynamicArrayStackPop(dynamicArrayStack *pStack)
     return dynamicArrayDeleteData(pStack);
 }
 
+/* 批量压栈: vals[num - 1] 最后压入, 成为栈顶 */
+int dynamicArrayStackPushN(dynamicArrayStack *pStack, ELEMENTTYPE *vals, int num)
+{
+    /* 一次扩容 + 一次拷贝 */
+    return dynamicArrayAppendBatch(pStack, vals, num);
+}
+
+/* 批量出栈: 栈顶的 num 个元素按原来的顺序拷贝到 buf (buf[num - 1] 是原来的栈顶),
+ * 栈里不够 num 个时全部弹出, 实际个数通过 pPopNum 返回 */
+int dynamicArrayStackPopN(dynamicArrayStack *pStack, ELEMENTTYPE *buf, int num, int *pPopNum)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (num < 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    if (num > pStack->len)
+    {
+        num = pStack->len;
+    }
+
+    /* 一次拷贝 */
+    if (buf != NULL)
+    {
+        memcpy(buf, pStack->data + pStack->len - num, sizeof(ELEMENTTYPE) * num);
+    }
+    if (pPopNum != NULL)
+    {
+        *pPopNum = num;
+    }
+    return dynamicArrayTruncate(pStack, pStack->len - num);
+}
+
+/* 清空栈 */
+int dynamicArrayStackClear(dynamicArrayStack *pStack)
+{
+    return dynamicArrayTruncate(pStack, 0);
+}
+
 /* 栈是否为空 */
 int dynamicArrayStackIsEmpty(dynamicArrayStack *pStack)
 {
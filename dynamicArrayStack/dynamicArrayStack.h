@@ -18,6 +18,15 @@ int dynamicArrayStackTop(dynamicArrayStack *pStack, ELEMENTTYPE *pVal);
 /* 出栈 */
 int dynamicArrayStackPop(dynamicArrayStack *pStack);
 
+/* 批量压栈: vals[num - 1] 最后压入, 成为栈顶 */
+int dynamicArrayStackPushN(dynamicArrayStack *pStack, ELEMENTTYPE *vals, int num);
+
+/* 批量出栈: 栈顶的 num 个元素拷贝到 buf (buf[num - 1] 是原来的栈顶) */
+int dynamicArrayStackPopN(dynamicArrayStack *pStack, ELEMENTTYPE *buf, int num, int *pPopNum);
+
+/* 清空栈 */
+int dynamicArrayStackClear(dynamicArrayStack *pStack);
+
 /* 栈是否为空 */
 int dynamicArrayStackIsEmpty(dynamicArrayStack *pStack);
 
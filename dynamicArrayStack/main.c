@@ -1,5 +1,9 @@
 #include <stdio.h>
 #include "dynamicArrayStack.h"
+#include "concurrentStack.h"
+#include "segmentedStack.h"
+#include <pthread.h>
+#include <time.h>
 
 /* 怎么解决套壳问题 */
 
@@ -12,8 +16,135 @@ int isValid(char* s)
     
 }
 
+/* 置1: 运行多线程吞吐量测试 */
+#define RUN_STACK_BENCH     0
+/* 置1: 运行分段栈的示例 (跨越多个块, 检查元素地址不变) */
+#define RUN_SEGMENTED_STACK_DEMO    0
+
+/* 分段栈示例的元素个数: 跨越好几个块的边界 */
+#define SEGMENTED_DEMO_NUM  5000
+
+#if RUN_STACK_BENCH
+/* 多线程吞吐量测试: 每个线程交替压栈和出栈 */
+#define BENCH_THREAD_NUM    4
+#define BENCH_OP_NUM        1000000
+
+static dynamicArrayStack g_lockStack;
+static pthread_mutex_t g_stackMutex = PTHREAD_MUTEX_INITIALIZER;
+static concurrentStack *g_lockFreeStack = NULL;
+static int g_benchVal = 0;
+
+/* 互斥锁包装的动态数组栈 */
+static void * lockStackRoutine(void *arg)
+{
+    (void)arg;
+    ELEMENTTYPE val = NULL;
+    for (int idx = 0; idx < BENCH_OP_NUM; idx++)
+    {
+        pthread_mutex_lock(&g_stackMutex);
+        dynamicArrayStackPush(&g_lockStack, &g_benchVal);
+        pthread_mutex_unlock(&g_stackMutex);
+
+        pthread_mutex_lock(&g_stackMutex);
+        if (!dynamicArrayStackIsEmpty(&g_lockStack))
+        {
+            dynamicArrayStackTop(&g_lockStack, &val);
+            dynamicArrayStackPop(&g_lockStack);
+        }
+        pthread_mutex_unlock(&g_stackMutex);
+    }
+    return NULL;
+}
+
+/* 无锁栈 */
+static void * lockFreeStackRoutine(void *arg)
+{
+    (void)arg;
+    ELEMENTTYPE val = NULL;
+    for (int idx = 0; idx < BENCH_OP_NUM; idx++)
+    {
+        concurrentStackPush(g_lockFreeStack, &g_benchVal);
+        concurrentStackPop(g_lockFreeStack, &val);
+    }
+    return NULL;
+}
+
+/* 运行测试, 返回耗时(秒) */
+static double runStackBench(void * (*routine)(void *))
+{
+    struct timespec begin, end;
+    pthread_t tids[BENCH_THREAD_NUM];
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    for (int idx = 0; idx < BENCH_THREAD_NUM; idx++)
+    {
+        pthread_create(&tids[idx], NULL, routine, NULL);
+    }
+    for (int idx = 0; idx < BENCH_THREAD_NUM; idx++)
+    {
+        pthread_join(tids[idx], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return (end.tv_sec - begin.tv_sec) + (end.tv_nsec - begin.tv_nsec) / 1e9;
+}
+#endif
+
 int main()
 {
+#if RUN_STACK_BENCH
+    dynamicArrayStackInit(&g_lockStack);
+    concurrentStackInit(&g_lockFreeStack);
+
+    double lockCost = runStackBench(lockStackRoutine);
+    double lockFreeCost = runStackBench(lockFreeStackRoutine);
+    /* 每个线程 BENCH_OP_NUM 次压栈 + 出栈 */
+    double totalOps = 2.0 * BENCH_THREAD_NUM * BENCH_OP_NUM;
+    printf("mutex stack:     %.3fs\t%.2f Mops/s\n", lockCost, totalOps / lockCost / 1e6);
+    printf("lock-free stack: %.3fs\t%.2f Mops/s\n", lockFreeCost, totalOps / lockFreeCost / 1e6);
+
+    dynamicArrayStackDestroy(&g_lockStack);
+    concurrentStackDestroy(g_lockFreeStack);
+#elif RUN_SEGMENTED_STACK_DEMO
+    segmentedStack stack;
+    segmentedStackInit(&stack, SEGMENTED_STACK_DEFAULT_CHUNK_SIZE);
+
+    static int buffer[SEGMENTED_DEMO_NUM];
+    /* 压栈时记录每个元素的地址, 出栈时检查地址没有因为扩容而变化 */
+    static ELEMENTTYPE *addrs[SEGMENTED_DEMO_NUM];
+    int errorNum = 0;
+    for (int idx = 0; idx < SEGMENTED_DEMO_NUM; idx++)
+    {
+        buffer[idx] = idx;
+        segmentedStackPush(&stack, &buffer[idx]);
+        segmentedStackTopAddr(&stack, &addrs[idx]);
+    }
+
+    int size = 0;
+    segmentedStackGetSize(&stack, &size);
+    printf("size:%d\tchunk size:%d\n", size, SEGMENTED_STACK_DEFAULT_CHUNK_SIZE);
+
+    /* 第一个元素的地址在压满好几个块之后依然有效 */
+    printf("bottom addr:%p\tval:%d\n", (void *)addrs[0], *(int *)*addrs[0]);
+
+    int *val = NULL;
+    ELEMENTTYPE *addr = NULL;
+    for (int idx = SEGMENTED_DEMO_NUM - 1; idx >= 0; idx--)
+    {
+        segmentedStackTop(&stack, (void **)&val);
+        segmentedStackTopAddr(&stack, &addr);
+        if (addr != addrs[idx] || val != &buffer[idx] || *val != idx)
+        {
+            printf("mismatch: idx:%d\n", idx);
+            errorNum++;
+        }
+        segmentedStackPop(&stack);
+    }
+    printf("empty:%d\tmismatch:%d\n", segmentedStackIsEmpty(&stack), errorNum);
+
+    /* 栈的销毁 */
+    segmentedStackDestroy(&stack);
+#else
     dynamicArrayStack stack;
     dynamicArrayStackInit(&stack);
 
@@ -38,6 +169,7 @@ int main()
 
     /* 栈的销毁 */
     dynamicArrayStackDestroy(&stack);
+#endif
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "segmentedStack.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 状态码 */
+enum STATUS_CODE
+{
+    ON_SUCCESS,
+    NULL_PTR,
+    MALLOC_ERROR,
+    INVALID_ACCESS,
+};
+
+/* 静态函数前置声明 */
+static segmentedStackChunk * getFreeChunk(segmentedStack *pStack);
+
+/* 获取一个空块: 优先使用缓存的块 */
+static segmentedStackChunk * getFreeChunk(segmentedStack *pStack)
+{
+    segmentedStackChunk *chunk = pStack->spare;
+    if (chunk != NULL)
+    {
+        pStack->spare = NULL;
+    }
+    else
+    {
+        chunk = (segmentedStackChunk *)malloc(sizeof(segmentedStackChunk) + sizeof(ELEMENTTYPE) * pStack->chunkSize);
+        if (chunk == NULL)
+        {
+            return NULL;
+        }
+    }
+    chunk->prev = NULL;
+    chunk->len = 0;
+    return chunk;
+}
+
+/* 栈的初始化 (chunkSize <= 0 时使用默认大小) */
+int segmentedStackInit(segmentedStack *pStack, int chunkSize)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (chunkSize <= 0)
+    {
+        chunkSize = SEGMENTED_STACK_DEFAULT_CHUNK_SIZE;
+    }
+
+    /* 第一次压栈时才申请块 */
+    pStack->top = NULL;
+    pStack->spare = NULL;
+    pStack->chunkSize = chunkSize;
+    pStack->size = 0;
+    return ON_SUCCESS;
+}
+
+/* 压栈 */
+int segmentedStackPush(segmentedStack *pStack, ELEMENTTYPE val)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    /* 当前块满了: 链上一个新块, 不拷贝已有的元素 */
+    if (pStack->top == NULL || pStack->top->len == pStack->chunkSize)
+    {
+        segmentedStackChunk *chunk = getFreeChunk(pStack);
+        if (chunk == NULL)
+        {
+            return MALLOC_ERROR;
+        }
+        chunk->prev = pStack->top;
+        pStack->top = chunk;
+    }
+
+    pStack->top->data[(pStack->top->len)++] = val;
+    (pStack->size)++;
+    return ON_SUCCESS;
+}
+
+/* 查看栈顶元素 */
+int segmentedStackTop(segmentedStack *pStack, ELEMENTTYPE *pVal)
+{
+    ELEMENTTYPE *addr = NULL;
+    int ret = segmentedStackTopAddr(pStack, &addr);
+    if (ret != ON_SUCCESS)
+    {
+        return ret;
+    }
+
+    if (pVal != NULL)
+    {
+        *pVal = *addr;
+    }
+    return ON_SUCCESS;
+}
+
+/* 获取栈顶元素的地址 (出栈之前地址一直有效) */
+int segmentedStackTopAddr(segmentedStack *pStack, ELEMENTTYPE **pAddr)
+{
+    if (pStack == NULL || pAddr == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pStack->size == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    *pAddr = &pStack->top->data[pStack->top->len - 1];
+    return ON_SUCCESS;
+}
+
+/* 出栈 */
+int segmentedStackPop(segmentedStack *pStack)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pStack->size == 0)
+    {
+        return INVALID_ACCESS;
+    }
+
+    (pStack->top->len)--;
+    (pStack->size)--;
+
+    /* 当前块空了: 退回到下面一块, 空块留作缓存 */
+    if (pStack->top->len == 0)
+    {
+        segmentedStackChunk *chunk = pStack->top;
+        pStack->top = chunk->prev;
+        if (pStack->spare == NULL)
+        {
+            pStack->spare = chunk;
+        }
+        else
+        {
+            free(chunk);
+            chunk = NULL;
+        }
+    }
+    return ON_SUCCESS;
+}
+
+/* 栈是否为空 */
+int segmentedStackIsEmpty(segmentedStack *pStack)
+{
+    int size = 0;
+    segmentedStackGetSize(pStack, &size);
+    return size == 0 ? 1 : 0;
+}
+
+/* 获取栈的大小 */
+int segmentedStackGetSize(segmentedStack *pStack, int *pSize)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    if (pSize != NULL)
+    {
+        *pSize = pStack->size;
+    }
+    return pStack->size;
+}
+
+/* 栈的销毁 */
+int segmentedStackDestroy(segmentedStack *pStack)
+{
+    if (pStack == NULL)
+    {
+        return NULL_PTR;
+    }
+
+    segmentedStackChunk *chunk = pStack->top;
+    while (chunk != NULL)
+    {
+        segmentedStackChunk *prev = chunk->prev;
+        free(chunk);
+        chunk = prev;
+    }
+    if (pStack->spare != NULL)
+    {
+        free(pStack->spare);
+    }
+
+    pStack->top = NULL;
+    pStack->spare = NULL;
+    pStack->size = 0;
+    return ON_SUCCESS;
+}
@@ -0,0 +1,57 @@
+#ifndef __SEGMENTED_STACK_H_
+#define __SEGMENTED_STACK_H_
+
+#include "common.h"
+
+/* 默认每块存放的元素个数 */
+#define SEGMENTED_STACK_DEFAULT_CHUNK_SIZE  1024
+
+/* 栈的分块: 块满了就链一个新块, 已有的块不会搬移 */
+typedef struct segmentedStackChunk
+{
+    /* 下面一块 (更靠近栈底) */
+    struct segmentedStackChunk *prev;
+    /* 本块中元素的个数 */
+    int len;
+    /* 元素空间 */
+    ELEMENTTYPE data[];
+} segmentedStackChunk;
+
+/* 分段栈: 扩容不需要拷贝已有元素, 元素的地址在出栈之前一直有效 */
+typedef struct segmentedStack
+{
+    /* 栈顶所在的块 */
+    segmentedStackChunk *top;
+    /* 缓存一个空块, 在块边界上反复压栈/出栈时不会反复申请释放 */
+    segmentedStackChunk *spare;
+    /* 每块的元素个数 */
+    int chunkSize;
+    /* 栈的大小 */
+    int size;
+} segmentedStack;
+
+/* 栈的初始化 (chunkSize <= 0 时使用默认大小) */
+int segmentedStackInit(segmentedStack *pStack, int chunkSize);
+
+/* 压栈 */
+int segmentedStackPush(segmentedStack *pStack, ELEMENTTYPE val);
+
+/* 查看栈顶元素 */
+int segmentedStackTop(segmentedStack *pStack, ELEMENTTYPE *pVal);
+
+/* 获取栈顶元素的地址 (出栈之前地址一直有效) */
+int segmentedStackTopAddr(segmentedStack *pStack, ELEMENTTYPE **pAddr);
+
+/* 出栈 */
+int segmentedStackPop(segmentedStack *pStack);
+
+/* 栈是否为空 */
+int segmentedStackIsEmpty(segmentedStack *pStack);
+
+/* 获取栈的大小 */
+int segmentedStackGetSize(segmentedStack *pStack, int *pSize);
+
+/* 栈的销毁 */
+int segmentedStackDestroy(segmentedStack *pStack);
+
+#endif // __SEGMENTED_STACK_H_